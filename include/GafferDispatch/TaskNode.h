@@ -226,10 +226,24 @@ class GAFFERDISPATCH_API TaskNode : public Gaffer::DependencyNode
 		/// they so desire.
 		virtual void execute() const = 0;
 
-		/// Called by `TaskPlug::executeSequence()`.
+		/// Called by `TaskPlug::executeSequence()`. The default implementation
+		/// calls `execute()` once per frame, with a separate context for each.
+		/// If `canExecuteFramesConcurrently()` returns true and the
+		/// "dispatcher.frameConcurrency" plug is greater than 1, up to that
+		/// many frames are executed concurrently.
 		/// \todo Add `const TaskPlug *plug, const Context *context` arguments.
 		virtual void executeSequence( const std::vector<float> &frames ) const;
 
+		/// Called by the default implementation of `executeSequence()` to
+		/// determine whether or not several frames may be executed at once.
+		/// The default implementation returns false. Derived classes which
+		/// return true must ensure that concurrent calls to `execute()` are
+		/// safe, and should call `addFrameConcurrencyPlug()` from their
+		/// constructor so that the concurrency may be controlled by the user.
+		virtual bool canExecuteFramesConcurrently() const;
+		/// Adds the "dispatcher.frameConcurrency" plug.
+		void addFrameConcurrencyPlug();
+
 		/// Called by `TaskPlug::requiresSequenceExecution()`.
 		/// The default implementation returns false.
 		/// \todo Add `const TaskPlug *plug, const Context *context` arguments.
@@ -243,6 +243,27 @@ class TaskNodeWrapper : public GafferBindings::DependencyNodeWrapper<WrappedType
 			return WrappedType::requiresSequenceExecution();
 		}
 
+		bool canExecuteFramesConcurrently() const override
+		{
+			if( this->isSubclassed() )
+			{
+				IECorePython::ScopedGILLock gilLock;
+				try
+				{
+					boost::python::object canExec = this->methodOverride( "canExecuteFramesConcurrently" );
+					if( canExec )
+					{
+						return canExec();
+					}
+				}
+				catch( const boost::python::error_already_set &e )
+				{
+					IECorePython::ExceptionAlgo::translatePythonException();
+				}
+			}
+			return WrappedType::canExecuteFramesConcurrently();
+		}
+
 };
 
 } // namespace GafferDispatchBindings
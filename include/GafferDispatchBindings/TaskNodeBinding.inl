@@ -110,6 +110,18 @@ static bool requiresSequenceExecution( T &n )
 	return n.T::requiresSequenceExecution();
 }
 
+template<typename T>
+static bool canExecuteFramesConcurrently( T &n )
+{
+	return n.T::canExecuteFramesConcurrently();
+}
+
+template<typename T>
+static void addFrameConcurrencyPlug( T &n )
+{
+	n.addFrameConcurrencyPlug();
+}
+
 };
 
 } // namespace Detail
@@ -125,6 +137,8 @@ TaskNodeClass<T, Ptr>::TaskNodeClass( const char *docString )
 	this->def( "execute", &Detail::TaskNodeAccessor::execute<T> );
 	this->def( "executeSequence", &Detail::TaskNodeAccessor::executeSequence<T> );
 	this->def( "requiresSequenceExecution", &Detail::TaskNodeAccessor::requiresSequenceExecution<T> );
+	this->def( "canExecuteFramesConcurrently", &Detail::TaskNodeAccessor::canExecuteFramesConcurrently<T> );
+	this->def( "addFrameConcurrencyPlug", &Detail::TaskNodeAccessor::addFrameConcurrencyPlug<T> );
 }
 
 } // namespace GafferDispatchBindings
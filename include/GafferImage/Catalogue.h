@@ -110,7 +110,9 @@ class GAFFERIMAGE_API Catalogue : public ImageNode
 
 		/// Generates a filename that could be used for storing
 		/// a particular image locally in this Catalogue's directory.
-		/// Primarily exists to be used in the UI.
+		/// The filename is generated from the image hash, so no
+		/// pixels are computed. Primarily exists to be used in
+		/// the UI.
 		std::string generateFileName( const Image *image ) const;
 		std::string generateFileName( const ImagePlug *image ) const;
 
@@ -131,6 +133,10 @@ class GAFFERIMAGE_API Catalogue : public ImageNode
 		static InternalImage *imageNode( Image *image );
 		static const InternalImage *imageNode( const Image *image );
 
+		/// Returns the directory images are saved to, with
+		/// substitutions applied, or "" if there is none.
+		std::string saveDirectory() const;
+
 		void imageAdded( GraphComponent *graphComponent );
 		void imageRemoved( GraphComponent *graphComponent );
 
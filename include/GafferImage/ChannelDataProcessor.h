@@ -79,6 +79,14 @@ class GAFFERIMAGE_API ChannelDataProcessor : public ImageProcessor
 		/// @param outData The tile where the result of the operation should be written. It is initialized with the coresponding tile data from inPlug() which should be used as the input data.
 		virtual void processChannelData( const Gaffer::Context *context, const ImagePlug *parent, const std::string &channel, IECore::FloatVectorDataPtr outData ) const = 0;
 
+		/// May be overridden to return true if processChannelData() computes each output value
+		/// purely from the corresponding value in `outData`, without regard to its position or to
+		/// any other channels. Constant input tiles are then processed as a single value, and the
+		/// result is output using `ImagePlug::constantTile()`. Implementations must therefore
+		/// process `outData->readable().size()` values rather than assuming a full tile. The
+		/// default implementation returns false.
+		virtual bool perPixel() const;
+
 	private :
 
 		static size_t g_firstPlugIndex;
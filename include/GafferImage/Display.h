@@ -101,6 +101,8 @@ class GAFFERIMAGE_API Display : public ImageNode
 
 		Gaffer::IntPlug *updateCountPlug();
 		const Gaffer::IntPlug *updateCountPlug() const;
+		Gaffer::IntPlug *driverCountPlug();
+		const Gaffer::IntPlug *driverCountPlug() const;
 
 		void setupDriver( GafferDisplayDriverPtr driver );
 		void dataReceived();
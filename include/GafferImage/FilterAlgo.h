@@ -67,6 +67,12 @@ inline Imath::Box2f filterSupport( const Imath::V2f &p, float dx, float dy, floa
 // filterSupport above may be used to compute an appropriate bound.
 GAFFERIMAGE_API float sampleBox( Sampler &sampler, const Imath::V2f &p, float dx, float dy, const OIIO::Filter2D *filter, std::vector<float> &scratchMemory );
 
+// As above, but sampling from a buffer holding the pixels of `bufferWindow`, stored in rows starting with
+// the row at `bufferWindow.min.y`. This can be filled using `Sampler::sampleRegion()`, and is useful when
+// filtering many overlapping regions, because it avoids repeating the tile lookups for each one. The buffer
+// must cover all pixels with centers lying within the support of the filter.
+GAFFERIMAGE_API float sampleBox( const float *buffer, const Imath::Box2i &bufferWindow, const Imath::V2f &p, float dx, float dy, const OIIO::Filter2D *filter, std::vector<float> &scratchMemory );
+
 // Sample over a parallelogram shaped region defined by a center point and two derivative directions.
 // The sampler must have been initialized to cover all pixels with centers lying with the support of the filter
 // I haven't actually exposed anything that would make this easy to compute at the moment, because it doesn't
@@ -99,6 +99,22 @@ class GAFFERIMAGE_API Format
 		inline Imath::Box2i toEXRSpace( const Imath::Box2i &internalSpace ) const;
 		//@}
 
+		/// @name Resolution levels
+		/// Methods to assist in scaling formats and pixel coordinates
+		/// to a reduced resolution level, as specified by the
+		/// `image:resolutionLevel` context variable. See
+		/// `ImagePlug::resolutionLevelContextName` for more details.
+		////////////////////////////////////////////////////////////////////
+		//@{
+		/// Returns the equivalent format at the specified level.
+		inline Format atResolutionLevel( int level ) const;
+		/// Scales a window of pixels to the specified level, rounding outwards.
+		static inline Imath::Box2i atResolutionLevel( const Imath::Box2i &window, int level );
+		/// Returns the factor by which pixel distances are scaled at the
+		/// specified level.
+		static inline float resolutionScale( int level );
+		//@}
+
 		/// @name Format registry
 		/// Maintains a list of named formats which may be registered
 		/// by config files, and made available to the user via the UI.
@@ -39,6 +39,9 @@
 
 #include "GafferImage/BufferAlgo.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace GafferImage
 {
 
@@ -161,6 +164,30 @@ inline Imath::Box2i Format::toEXRSpace( const Imath::Box2i &internalSpace ) cons
 	);
 }
 
+inline Format Format::atResolutionLevel( int level ) const
+{
+	return Format( atResolutionLevel( m_displayWindow, level ), m_pixelAspect );
+}
+
+inline Imath::Box2i Format::atResolutionLevel( const Imath::Box2i &window, int level )
+{
+	if( level <= 0 || BufferAlgo::empty( window ) )
+	{
+		return window;
+	}
+
+	const double s = resolutionScale( level );
+	return Imath::Box2i(
+		Imath::V2i( (int)floor( window.min.x * s ), (int)floor( window.min.y * s ) ),
+		Imath::V2i( (int)ceil( window.max.x * s ), (int)ceil( window.max.y * s ) )
+	);
+}
+
+inline float Format::resolutionScale( int level )
+{
+	return ldexp( 1.0f, -std::max( level, 0 ) );
+}
+
 } // namespace GafferImage
 
 #endif // GAFFERIMAGE_FORMAT_INL
@@ -89,7 +89,10 @@ class GAFFERIMAGE_API FormatPlug : public Gaffer::ValuePlug
 		/// \undoable
 		void setValue( const Format &value );
 		/// Implemented to substitute in the default format from the current
-		/// context if the current value is empty.
+		/// context if the current value is empty, and to scale the result
+		/// to the resolution level specified by the current context. The
+		/// `format` child of an ImagePlug is not scaled, because the node
+		/// which generated the image has already scaled it.
 		/// \note Substitution is not performed automatically when accessing
 		/// individual components (display window and pixel aspect) from the
 		/// child plugs directly.
@@ -129,6 +132,8 @@ class GAFFERIMAGE_API FormatPlug : public Gaffer::ValuePlug
 		void parentChanging( Gaffer::GraphComponent *newParent ) override;
 		void plugDirtied( Gaffer::Plug *plug );
 
+		bool reducesToResolutionLevel() const;
+
 		Format m_defaultValue;
 		boost::signals::scoped_connection m_plugDirtiedConnection;
 
@@ -117,6 +117,37 @@ class GAFFERIMAGE_API ImagePlug : public Gaffer::ValuePlug
 		static const IECore::InternedString channelNameContextName;
 		static const IECore::InternedString tileOriginContextName;
 
+		/// The name of an optional context variable used to evaluate
+		/// images at reduced resolution for interactive review. At level
+		/// `n` each dimension is reduced by a factor of `2^n`, so level 0
+		/// is full resolution. Readers and nodes with formats or spatial
+		/// parameters scale them to match, so that the same graph may be
+		/// evaluated at any level. Unlike the variables above, this is
+		/// global to the whole image, and is not removed by GlobalScope.
+		///
+		/// Parameters are always specified at full resolution. Nodes
+		/// with parameters measured in pixels scale them to the level
+		/// being computed, and currently these are :
+		///
+		/// - Blur, Median, Erode and Dilate (radius).
+		/// - Crop and ImageStats (area).
+		/// - ImageTransform, Rectangle, Text and Ramp (transform and
+		///   positions).
+		/// - Shape (shadow offset and blur).
+		/// - Offset (rounded to the nearest pixel).
+		/// - VectorWarp (vectors measured in pixels).
+		/// - ImageSampler (pixel).
+		/// - Checkerboard (size and transform).
+		///
+		/// Nodes deriving their output from a FormatPlug, such as
+		/// Constant and Resize, follow automatically. Nodes not listed
+		/// here have no pixel-space parameters. Any node added with such
+		/// parameters must scale them too, using `Format::resolutionScale()`
+		/// or `Format::atResolutionLevel()`.
+		static const IECore::InternedString resolutionLevelContextName;
+		/// Returns the resolution level specified by `context`.
+		static int resolutionLevel( const Gaffer::Context *context );
+
 		/// @name Convenience accessors
 		/// These functions create temporary Contexts specifying image:channelName
 		/// and image:tileOrigin, and use them to return useful output.
@@ -160,6 +191,24 @@ class GAFFERIMAGE_API ImagePlug : public Gaffer::ValuePlug
 		static const IECore::FloatVectorData *blackTile();
 		static const IECore::FloatVectorData *whiteTile();
 
+		/// Constant tiles
+		/// ==============
+		///
+		/// Tiles where every pixel has the same value are common, for instance
+		/// in the padding of large data windows and in mattes. Rather than
+		/// allocating a tile of their own, nodes may return `constantTile()`,
+		/// which shares a single tile between all requests for the same value.
+		/// Nodes may use `isConstantTile()` to detect constant inputs and
+		/// provide fast paths for them.
+
+		/// Returns a tile with every pixel set to `value`. Repeated calls
+		/// with the same value return the same tile, and the `blackTile()`
+		/// and `whiteTile()` are returned for 0 and 1 respectively.
+		static IECore::ConstFloatVectorDataPtr constantTile( float value );
+		/// Returns true if every pixel in `tile` has the same value,
+		/// storing it in `value`.
+		static bool isConstantTile( const IECore::FloatVectorData *tile, float &value );
+
 		/// Returns the index of the tile containing a point
 		/// This just means dividing by tile size ( always rounding down )
 		inline static const Imath::V2i tileIndex( const Imath::V2i &point )
@@ -42,11 +42,13 @@
 #include "Gaffer/CompoundNumericPlug.h"
 
 #include <functional>
+#include <memory>
 
 namespace Gaffer
 {
 
 IE_CORE_FORWARDDECLARE( StringPlug )
+class BackgroundTask;
 
 } // namespace Gaffer
 
@@ -116,6 +118,11 @@ class GAFFERIMAGE_API ImageReader : public ImageNode
 
 		static size_t supportedExtensions( std::vector<std::string> &extensions );
 
+		/// Reads the specified frames in the background, so that they are
+		/// already cached when they are needed. See `OpenImageIOReader::prefetch()`
+		/// for details.
+		std::unique_ptr<Gaffer::BackgroundTask> prefetch( const std::vector<float> &frames ) const;
+
 		/// A function which can take information about a file being read, and return the colorspace
 		/// of the data within the file. This is used whenever the colorSpace plug is at its default
 		/// value.
@@ -84,6 +84,9 @@ class GAFFERIMAGE_API ImageSampler : public Gaffer::ComputeNode
 		// Returns the channel to be read for the specified child of colorPlug(),
 		// returning the empty string if the channel doesn't exist.
 		std::string channelName( const Gaffer::ValuePlug *output ) const;
+		// Returns the value of pixelPlug(), scaled to the resolution level
+		// specified by `context`.
+		Imath::V2f pixel( const Gaffer::Context *context ) const;
 
 		static size_t g_firstPlugIndex;
 
@@ -42,6 +42,8 @@
 #include "Gaffer/BoxPlug.h"
 #include "Gaffer/CompoundNumericPlug.h"
 #include "Gaffer/ComputeNode.h"
+#include "Gaffer/NumericPlug.h"
+#include "Gaffer/TypedObjectPlug.h"
 
 namespace GafferImage
 {
@@ -69,6 +71,15 @@ class GAFFERIMAGE_API ImageStats : public Gaffer::ComputeNode
 		Gaffer::Box2iPlug *areaPlug();
 		const Gaffer::Box2iPlug *areaPlug() const;
 
+		Gaffer::IntPlug *histogramBinsPlug();
+		const Gaffer::IntPlug *histogramBinsPlug() const;
+
+		Gaffer::V2fPlug *histogramRangePlug();
+		const Gaffer::V2fPlug *histogramRangePlug() const;
+
+		Gaffer::FloatPlug *percentilePlug();
+		const Gaffer::FloatPlug *percentilePlug() const;
+
 		Gaffer::Color4fPlug *averagePlug();
 		const Gaffer::Color4fPlug *averagePlug() const;
 
@@ -78,6 +89,17 @@ class GAFFERIMAGE_API ImageStats : public Gaffer::ComputeNode
 		Gaffer::Color4fPlug *maxPlug();
 		const Gaffer::Color4fPlug *maxPlug() const;
 
+		/// Has four IntVectorDataPlug children, named "r", "g",
+		/// "b" and "a", each holding the histogram for the
+		/// corresponding channel.
+		Gaffer::ValuePlug *histogramPlug();
+		const Gaffer::ValuePlug *histogramPlug() const;
+
+		/// The value below which `percentile` percent of the
+		/// samples fall, estimated from the histogram.
+		Gaffer::Color4fPlug *percentileValuePlug();
+		const Gaffer::Color4fPlug *percentileValuePlug() const;
+
 	protected :
 
 		/// Implemented to hash the area we are sampling along with the channel context and regionOfInterest.
@@ -88,7 +110,26 @@ class GAFFERIMAGE_API ImageStats : public Gaffer::ComputeNode
 
 	private :
 
+		// Statistics are computed in two stages. Stats for each
+		// individual tile are computed in parallel, and are then
+		// gathered to produce the stats for the whole area. The
+		// per-tile stats depend only on the part of the area that
+		// overlaps the tile, so when the area is moved, only the
+		// stats for the tiles at its edges need to be recomputed.
+		// Both plugs are evaluated in a context containing
+		// `image:channelName`, and the tile stats additionally
+		// require `image:tileOrigin`.
+		Gaffer::CompoundObjectPlug *tileStatsPlug();
+		const Gaffer::CompoundObjectPlug *tileStatsPlug() const;
+
+		Gaffer::CompoundObjectPlug *allStatsPlug();
+		const Gaffer::CompoundObjectPlug *allStatsPlug() const;
+
 		std::string channelName( int colorIndex ) const;
+		/// Returns the intersection of the area with the data window.
+		/// Pixels in the area but outside this window are treated as
+		/// having a value of zero.
+		Imath::Box2i statsWindow( const Gaffer::Context *context ) const;
 
 		static size_t g_firstPlugIndex;
 
@@ -104,6 +104,13 @@ class GAFFERIMAGE_API ImageWriter : public GafferDispatch::TaskNode
 		static void setDefaultColorSpaceFunction( DefaultColorSpaceFunction f );
 		static DefaultColorSpaceFunction getDefaultColorSpaceFunction();
 
+	protected :
+
+		/// Returns true if the file name varies with the frame,
+		/// so that each frame is written to a separate file.
+		/// Frames sharing a single file are written serially.
+		bool canExecuteFramesConcurrently() const override;
+
 	private :
 
 		std::string colorSpace() const;
@@ -42,10 +42,13 @@
 
 #include "Gaffer/NumericPlug.h"
 
+#include <memory>
+
 namespace Gaffer
 {
 
 IE_CORE_FORWARDDECLARE( StringPlug )
+class BackgroundTask;
 
 } // namespace Gaffer
 
@@ -86,6 +89,42 @@ class GAFFERIMAGE_API OpenImageIOReader : public ImageNode
 
 		static size_t supportedExtensions( std::vector<std::string> &extensions );
 
+		/// Prefetching
+		/// ===========
+		///
+		/// Files are normally opened and read on demand, by whichever thread
+		/// first requests their channel data. When a client such as the Viewer
+		/// or a dispatcher knows which frames will be needed next, it may use
+		/// `prefetch()` to open and read them ahead of time, so that subsequent
+		/// computes find the data already in the cache.
+
+		/// Launches a background task which opens the files for the specified
+		/// frames and reads all their channel data, using a copy of the current
+		/// context. Frames are prefetched approximately in the order given. The
+		/// returned task may be used to cancel the prefetch, and it is also
+		/// cancelled automatically if the node is edited. Missing frames are
+		/// ignored.
+		std::unique_ptr<Gaffer::BackgroundTask> prefetch( const std::vector<float> &frames ) const;
+
+		/// Limits the number of prefetch reads which may be performed in
+		/// parallel, so that I/O does not occupy all the threads available for
+		/// computation. Defaults to 4.
+		static void setPrefetchConcurrency( int concurrency );
+		static int getPrefetchConcurrency();
+
+		/// Cache compression
+		/// =================
+		///
+		/// Tiles read from file are stored in the compute cache until they are
+		/// evicted. Tiles containing a single constant value are always stored
+		/// using a single sample, but other tiles are stored uncompressed by
+		/// default. Turning on cache compression stores them using a lossless
+		/// byte-shuffle and run-length encoding, so that more frames fit in the
+		/// cache at the expense of decompressing each tile when it is accessed.
+		/// Changes only affect subsequent reads.
+		static void setCacheCompression( bool compression );
+		static bool getCacheCompression();
+
 	protected :
 
 		void hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
@@ -110,6 +149,9 @@ class GAFFERIMAGE_API OpenImageIOReader : public ImageNode
 
 		void hashFileName( const Gaffer::Context *context, IECore::MurmurHash &h ) const;
 
+		// Reads all the tile batches for the frame in the current context.
+		void prefetchFrame( const Gaffer::Context *context ) const;
+
 		void plugSet( Gaffer::Plug *plug );
 
 		static size_t g_firstPlugIndex;
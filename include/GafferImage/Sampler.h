@@ -95,6 +95,24 @@ class GAFFERIMAGE_API Sampler
 		/// 0.5, 0.5.
 		inline float sample( float x, float y );
 
+		/// Bulk access
+		/// ===========
+		///
+		/// These methods are equivalent to calling `sample( int x, int y )`
+		/// for every pixel in turn, but fetch whole runs of pixels from
+		/// each tile at once, so should be preferred when many neighbouring
+		/// pixels are required. As with `sample()`, it is the caller's
+		/// responsibility to ensure that the pixels are contained within
+		/// the sample window.
+
+		/// Fills `result` with the values of the pixels from `xBegin`
+		/// up to (but not including) `xEnd` in row `y`.
+		inline void sampleRow( int y, int xBegin, int xEnd, float *result );
+		/// Fills `result` with the values of all the pixels in `region`,
+		/// stored in rows of `region.size().x` values, starting with the
+		/// row at `region.min.y`.
+		inline void sampleRegion( const Imath::Box2i &region, float *result );
+
 		/// Appends a hash that represent all the pixel
 		/// values within the requested sample area.
 		void hash( IECore::MurmurHash &h ) const;
@@ -110,6 +128,10 @@ class GAFFERIMAGE_API Sampler
 		/// @param tilePixelIndex XY indices that can be used to access the colour value of point 'p' from tileData.
 		inline void cachedData( Imath::V2i p, const float *& tileData, Imath::V2i &tilePixelIndex );
 
+		/// Copies a run of pixels which are known to be inside the data window,
+		/// one tile at a time.
+		inline void cachedRow( int y, int xBegin, int xEnd, float *result );
+
 		const ImagePlug *m_plug;
 		const std::string m_channelName;
 		Imath::Box2i m_sampleWindow;
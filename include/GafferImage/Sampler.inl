@@ -38,6 +38,8 @@
 
 #include "OpenImageIO/fmath.h"
 
+#include <algorithm>
+
 namespace GafferImage
 {
 
@@ -94,6 +96,111 @@ float Sampler::sample( float x, float y )
 	return OIIO::bilerp( x0y0, x1y0, x0y1, x1y1, xf, yf );
 }
 
+void Sampler::sampleRow( int y, int xBegin, int xEnd, float *result )
+{
+#ifndef NDEBUG
+
+	// It is the caller's responsibility to ensure that sampling
+	// is only performed within the sample window.
+	assert( xBegin >= xEnd || BufferAlgo::contains( m_sampleWindow, Imath::V2i( xBegin, y ) ) );
+	assert( xBegin >= xEnd || BufferAlgo::contains( m_sampleWindow, Imath::V2i( xEnd - 1, y ) ) );
+
+#endif
+
+	if( xBegin >= xEnd )
+	{
+		return;
+	}
+
+	if( m_boundingMode == -1 )
+	{
+		cachedRow( y, xBegin, xEnd, result );
+		return;
+	}
+
+	// Deal with lookups outside of the data window, by
+	// splitting the row into the part before the data window,
+	// the part inside it, and the part after it.
+
+	if( BufferAlgo::empty( m_dataWindow ) )
+	{
+		std::fill( result, result + ( xEnd - xBegin ), 0.0f );
+		return;
+	}
+
+	if( m_boundingMode == Black )
+	{
+		if( y < m_dataWindow.min.y || y >= m_dataWindow.max.y )
+		{
+			std::fill( result, result + ( xEnd - xBegin ), 0.0f );
+			return;
+		}
+	}
+	else
+	{
+		y = std::max( m_dataWindow.min.y, std::min( m_dataWindow.max.y - 1, y ) );
+	}
+
+	const int beforeEnd = std::min( xEnd, m_dataWindow.min.x );
+	if( beforeEnd > xBegin )
+	{
+		float v = 0.0f;
+		if( m_boundingMode == Clamp )
+		{
+			cachedRow( y, m_dataWindow.min.x, m_dataWindow.min.x + 1, &v );
+		}
+		std::fill( result, result + ( beforeEnd - xBegin ), v );
+	}
+
+	const int insideBegin = std::max( xBegin, m_dataWindow.min.x );
+	const int insideEnd = std::min( xEnd, m_dataWindow.max.x );
+	if( insideEnd > insideBegin )
+	{
+		cachedRow( y, insideBegin, insideEnd, result + ( insideBegin - xBegin ) );
+	}
+
+	const int afterBegin = std::max( xBegin, m_dataWindow.max.x );
+	if( xEnd > afterBegin )
+	{
+		float v = 0.0f;
+		if( m_boundingMode == Clamp )
+		{
+			cachedRow( y, m_dataWindow.max.x - 1, m_dataWindow.max.x, &v );
+		}
+		std::fill( result + ( afterBegin - xBegin ), result + ( xEnd - xBegin ), v );
+	}
+}
+
+void Sampler::sampleRegion( const Imath::Box2i &region, float *result )
+{
+	const int width = region.size().x;
+	if( width <= 0 )
+	{
+		return;
+	}
+
+	for( int y = region.min.y; y < region.max.y; ++y )
+	{
+		sampleRow( y, region.min.x, region.max.x, result );
+		result += width;
+	}
+}
+
+void Sampler::cachedRow( int y, int xBegin, int xEnd, float *result )
+{
+	const float *tileData;
+	Imath::V2i tileIndex;
+	while( xBegin < xEnd )
+	{
+		cachedData( Imath::V2i( xBegin, y ), tileData, tileIndex );
+		const int n = std::min( xEnd - xBegin, ImagePlug::tileSize() - tileIndex.x );
+		const float *row = tileData + tileIndex.y * ImagePlug::tileSize() + tileIndex.x;
+		std::copy( row, row + n, result );
+		result += n;
+		xBegin += n;
+	}
+}
+
 void Sampler::cachedData( Imath::V2i p, const float *& tileData, Imath::V2i &tilePixelIndex )
 {
 	// Get the smart pointer to the tile we want.
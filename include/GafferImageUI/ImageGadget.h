@@ -50,6 +50,8 @@
 #include "IECore/MurmurHash.h"
 #include "IECore/VectorTypedData.h"
 
+#include "boost/optional.hpp"
+
 #include "tbb/concurrent_unordered_map.h"
 #include "tbb/spin_mutex.h"
 
@@ -233,8 +235,10 @@ class GAFFERIMAGEUI_API ImageGadget : public GafferUI::Gadget
 			// such that they become visible to the UI thread together.
 			static void applyUpdates( const std::vector<Update> &updates );
 
-			// Called from the UI thread.
-			const IECoreGL::Texture *texture( bool &active );
+			// Called from the UI thread. Pending channel data is only
+			// converted to a texture if `uploadBudget` is non-zero, in
+			// which case the budget is decremented.
+			const IECoreGL::Texture *texture( bool &active, size_t &uploadBudget );
 
 			private :
 
@@ -254,14 +258,52 @@ class GAFFERIMAGEUI_API ImageGadget : public GafferUI::Gadget
 		friend size_t tbb_hasher( const ImageGadget::TileIndex &tileIndex );
 
 		// Tile update. We update tiles asynchronously from background
-		// threads.
+		// threads, in order of priority. Tiles visible in the viewport
+		// come first, and are ordered by their distance from the cursor,
+		// or from the centre of the viewport if the cursor is elsewhere.
+		// Priorities are updated on the UI thread as the user pans, zooms
+		// and moves the cursor, and are applied as each tile is dequeued
+		// for computation. This means that interaction never needs to
+		// cancel the update and discard the tiles in flight.
 
 		void updateTiles();
 		void removeOutOfBoundsTiles() const;
+		// May be called from any thread. Calls `requestRender()`
+		// on the UI thread.
+		void scheduleRenderRequest();
+
+		struct TilePriority
+		{
+			Imath::Box2i visibleWindow;
+			Imath::V2f position = Imath::V2f( 0 );
+			// Returns a key such that higher priority tiles
+			// compare less than lower priority ones.
+			std::pair<bool, float> key( const Imath::V2i &tileOrigin ) const;
+		};
+
+		void updateTilePriority() const;
+		TilePriority tilePriority() const;
+
+		mutable TilePriority m_tilePriority;
+		typedef tbb::spin_mutex TilePriorityMutex;
+		mutable TilePriorityMutex m_tilePriorityMutex;
 
 		std::unique_ptr<Gaffer::BackgroundTask> m_tilesTask;
 		std::atomic_bool m_renderRequestPending;
 
+		// Cursor tracking, for tile priorities. Because we don't
+		// take part in selection, mouse events are never sent to us
+		// directly, so we monitor the events sent to the viewport.
+
+		void parentChanged();
+		bool viewportMouseMove( const GafferUI::ButtonEvent &event );
+		void viewportLeave();
+
+		boost::signals::scoped_connection m_viewportMouseMoveConnection;
+		boost::signals::scoped_connection m_viewportLeaveConnection;
+		// In raster space.
+		boost::optional<Imath::V2f> m_cursorPosition;
+
 		// Rendering.
 
 		void visibilityChanged();
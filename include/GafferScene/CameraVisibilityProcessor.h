@@ -0,0 +1,122 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2026, Image Engine Design Inc. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef GAFFERSCENE_CAMERAVISIBILITYPROCESSOR_H
+#define GAFFERSCENE_CAMERAVISIBILITYPROCESSOR_H
+
+#include "GafferScene/FilteredSceneProcessor.h"
+
+#include "Gaffer/TypedObjectPlug.h"
+
+namespace Gaffer
+{
+
+IE_CORE_FORWARDDECLARE( StringPlug )
+
+} // namespace Gaffer
+
+namespace GafferScene
+{
+
+/// Base class for nodes which make filtered locations invisible according
+/// to how they are seen by a camera. The camera is found and sampled once
+/// per context by an internal plug, rather than once for every location.
+/// Locations which remain visible pass through with their input attributes
+/// hash.
+class GAFFERSCENE_API CameraVisibilityProcessor : public FilteredSceneProcessor
+{
+
+	public :
+
+		~CameraVisibilityProcessor() override;
+
+		IE_CORE_DECLARERUNTIMETYPEDEXTENSION( GafferScene::CameraVisibilityProcessor, CameraVisibilityProcessorTypeId, FilteredSceneProcessor );
+
+		/// The camera to use. If empty, the render
+		/// camera from the globals is used.
+		Gaffer::StringPlug *cameraPlug();
+		const Gaffer::StringPlug *cameraPlug() const;
+
+		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
+
+	protected :
+
+		CameraVisibilityProcessor( const std::string &name );
+
+		/// Names of the members of the CompoundObject returned by `cameraSamples()`.
+		static const IECore::InternedString camerasName;
+		static const IECore::InternedString worldToCameraName;
+		static const IECore::InternedString timesName;
+
+		/// Returns the samples of the camera, as a CompoundObject containing
+		/// an ObjectVector of cameras named `camerasName`, with the camera
+		/// globals applied, and the matching world to camera matrices and
+		/// sample times as M44fVectorData named `worldToCameraName` and
+		/// FloatVectorData named `timesName`. The camera is sampled at shutter open and close when motion
+		/// blur is enabled, and at the current frame otherwise. All are empty if
+		/// there is no camera. May be called with any context, since the samples
+		/// are always computed in a global scope.
+		IECore::ConstCompoundObjectPtr cameraSamples() const;
+
+		/// Must be implemented by derived classes to return true if the
+		/// location at `path` should be made invisible. This is called
+		/// when computing both the hash and the value of the attributes,
+		/// so should be cheap in comparison to the rendering it avoids.
+		virtual bool hidden( const ScenePath &path ) const = 0;
+
+		void hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
+		void compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const override;
+
+		void hashAttributes( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const override;
+		IECore::ConstCompoundObjectPtr computeAttributes( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent ) const override;
+
+	private :
+
+		Gaffer::ObjectPlug *cameraSamplesPlug();
+		const Gaffer::ObjectPlug *cameraSamplesPlug() const;
+
+		// Finds the camera, returning false if there is none.
+		bool cameraPath( const IECore::CompoundObject *globals, ScenePath &path ) const;
+
+		static size_t g_firstPlugIndex;
+
+};
+
+IE_CORE_DECLAREPTR( CameraVisibilityProcessor )
+
+} // namespace GafferScene
+
+#endif // GAFFERSCENE_CAMERAVISIBILITYPROCESSOR_H
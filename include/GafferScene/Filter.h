@@ -71,6 +71,13 @@ class GAFFERSCENE_API Filter : public Gaffer::ComputeNode
 
 		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
 
+		/// Returns true and fills `paths` if the locations matched by the filter
+		/// are known without computation, independent of the input scene and the
+		/// context. Matches may be overestimated but never underestimated. This
+		/// is intended for use in implementations of `SceneNode::affectedPaths()`,
+		/// and the default implementation returns false.
+		virtual bool knownMatches( IECore::PathMatcher &paths ) const;
+
 		/// \deprecated Use FilterPlug::SceneScope instead.
 		static void setInputScene( Gaffer::Context *context, const ScenePlug *scenePlug );
 		/// \deprecated
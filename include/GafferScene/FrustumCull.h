@@ -0,0 +1,95 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2026, Image Engine Design Inc. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef GAFFERSCENE_FRUSTUMCULL_H
+#define GAFFERSCENE_FRUSTUMCULL_H
+
+#include "GafferScene/CameraVisibilityProcessor.h"
+
+#include "Gaffer/NumericPlug.h"
+#include "Gaffer/TypedObjectPlug.h"
+
+namespace GafferScene
+{
+
+/// Makes locations invisible when their bounds are entirely outside
+/// the frustum of the render camera. Renderers don't traverse below
+/// invisible locations, so the objects of culled subtrees are never
+/// evaluated.
+class GAFFERSCENE_API FrustumCull : public CameraVisibilityProcessor
+{
+
+	public :
+
+		FrustumCull( const std::string &name=defaultName<FrustumCull>() );
+		~FrustumCull() override;
+
+		IE_CORE_DECLARERUNTIMETYPEDEXTENSION( GafferScene::FrustumCull, FrustumCullTypeId, CameraVisibilityProcessor );
+
+		/// Expands the frustum on each side, as a fraction
+		/// of the size of the screen window.
+		Gaffer::FloatPlug *paddingPlug();
+		const Gaffer::FloatPlug *paddingPlug() const;
+
+		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
+
+		/// Returns true if the location at `path` is matched by
+		/// the filter and culled in the current context.
+		bool culled( const ScenePath &path ) const;
+
+	protected :
+
+		void hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
+		void compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const override;
+
+		bool hidden( const ScenePath &path ) const override;
+
+	private :
+
+		// Lights and cameras, which are never culled because
+		// they affect the render even when off screen.
+		Gaffer::PathMatcherDataPlug *excludedPathsPlug();
+		const Gaffer::PathMatcherDataPlug *excludedPathsPlug() const;
+
+		static size_t g_firstPlugIndex;
+
+};
+
+IE_CORE_DECLAREPTR( FrustumCull )
+
+} // namespace GafferScene
+
+#endif // GAFFERSCENE_FRUSTUMCULL_H
@@ -77,6 +77,14 @@ class GAFFERSCENE_API Instancer : public BranchCreator
 		Gaffer::StringPlug *attributesPlug();
 		const Gaffer::StringPlug *attributesPlug() const;
 
+		/// When on, each `/instances/<instanceName>` location contains a
+		/// Capsule rather than a child location per point. The capsule
+		/// evaluates each prototype once at render time, and then outputs
+		/// one renderer object per point, all sharing the same prototype
+		/// object so that the renderer may instance it natively.
+		Gaffer::BoolPlug *encapsulateInstanceGroupsPlug();
+		const Gaffer::BoolPlug *encapsulateInstanceGroupsPlug() const;
+
 		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
 
 	protected :
@@ -108,6 +116,7 @@ class GAFFERSCENE_API Instancer : public BranchCreator
 	private :
 
 		IE_CORE_FORWARDDECLARE( EngineData );
+		class InstancerCapsule;
 
 		Gaffer::ObjectPlug *enginePlug();
 		const Gaffer::ObjectPlug *enginePlug() const;
@@ -126,6 +135,12 @@ class GAFFERSCENE_API Instancer : public BranchCreator
 			InstanceScope( const Gaffer::Context *context, const ScenePath &branchPath );
 		};
 
+		void plugDirtied( const Gaffer::Plug *plug );
+
+		// Counts the dirtying of the instances scene, for use
+		// in hashing capsules. See `hashBranchObject()`.
+		uint64_t m_instancesDirtyCount;
+
 		static size_t g_firstPlugIndex;
 
 };
@@ -0,0 +1,93 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2026, Image Engine Design Inc. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef GAFFERSCENE_LEVELOFDETAIL_H
+#define GAFFERSCENE_LEVELOFDETAIL_H
+
+#include "GafferScene/CameraVisibilityProcessor.h"
+
+#include "Gaffer/TypedObjectPlug.h"
+
+namespace GafferScene
+{
+
+/// Chooses between alternative representations of a location according
+/// to its size on screen, as seen by the render camera. The filter
+/// specifies "level of detail groups", the children of which are treated
+/// as representations ordered from highest to lowest detail. All but the
+/// chosen representation are made invisible, so that renderers neither
+/// evaluate nor render them.
+class GAFFERSCENE_API LevelOfDetail : public CameraVisibilityProcessor
+{
+
+	public :
+
+		LevelOfDetail( const std::string &name=defaultName<LevelOfDetail>() );
+		~LevelOfDetail() override;
+
+		IE_CORE_DECLARERUNTIMETYPEDEXTENSION( GafferScene::LevelOfDetail, LevelOfDetailTypeId, CameraVisibilityProcessor );
+
+		/// Screen sizes at which to switch to the next representation,
+		/// measured as a fraction of the width of the screen window and
+		/// given in decreasing order.
+		Gaffer::FloatVectorDataPlug *thresholdsPlug();
+		const Gaffer::FloatVectorDataPlug *thresholdsPlug() const;
+
+		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
+
+		/// Returns the index of the child of `path` chosen
+		/// for rendering, in the current context. When motion
+		/// blur is enabled, the largest screen size over the
+		/// shutter is used.
+		size_t representation( const ScenePath &path ) const;
+
+	protected :
+
+		// Returns true if `path` is a representation
+		// which has not been chosen.
+		bool hidden( const ScenePath &path ) const override;
+
+	private :
+
+		static size_t g_firstPlugIndex;
+
+};
+
+IE_CORE_DECLAREPTR( LevelOfDetail )
+
+} // namespace GafferScene
+
+#endif // GAFFERSCENE_LEVELOFDETAIL_H
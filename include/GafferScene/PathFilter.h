@@ -60,6 +60,10 @@ class GAFFERSCENE_API PathFilter : public Filter
 
 		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
 
+		/// Implemented to return the precomputed paths when they are
+		/// not context varying.
+		bool knownMatches( IECore::PathMatcher &paths ) const override;
+
 	protected :
 
 		void hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
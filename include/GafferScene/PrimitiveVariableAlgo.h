@@ -0,0 +1,112 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2026, Image Engine Design Inc. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef GAFFERSCENE_PRIMITIVEVARIABLEALGO_H
+#define GAFFERSCENE_PRIMITIVEVARIABLEALGO_H
+
+#include "GafferScene/Export.h"
+
+#include "IECore/Export.h"
+
+IECORE_PUSH_DEFAULT_VISIBILITY
+#include "OpenEXR/ImathMatrix.h"
+IECORE_POP_DEFAULT_VISIBILITY
+
+#include <cstddef>
+
+namespace IECoreScene
+{
+
+class Primitive;
+
+} // namespace IECoreScene
+
+namespace GafferScene
+{
+
+namespace PrimitiveVariableAlgo
+{
+
+/// Parallel processing
+/// ===================
+///
+/// Primitives may contain many millions of elements, so nodes which process
+/// primitive variables element by element should use these utilities to
+/// distribute the work across threads.
+///
+/// \todo MeshTangents, MeshDistortion, ReverseWinding, DeleteFaces, DeletePoints
+/// and DeleteCurves delegate their per-element work to the serial algorithms in
+/// IECoreScene. They would be better served by parallelising those algorithms
+/// in Cortex than by reimplementing them here.
+
+/// The number of elements processed by each task, unless otherwise specified.
+/// This is large enough to amortise the cost of scheduling, while still allowing
+/// cancellation to be responsive.
+const size_t defaultGrainSize = 10000;
+
+/// Calls `functor( begin, end )` in parallel for consecutive ranges of the
+/// elements in `[0, size)`, with each range containing approximately `grainSize`
+/// elements. Functors should be written as a simple loop over the range, so that
+/// the compiler may vectorise it. Cancellation of the current context is checked
+/// before each range is processed.
+///
+/// > Note : The functor is not called with the current context in scope. If the
+/// > functor needs to access plugs, it must first make a `Gaffer::Context::Scope`.
+template<typename Functor>
+void parallelProcessElements( size_t size, Functor &&functor, size_t grainSize = defaultGrainSize );
+
+/// Returns new data of the same type and interpretation as `data`, with each element
+/// given by `functor( inputElement )`. Elements are computed in parallel. This should be
+/// preferred to modifying the `writable()` vector of a copied primitive variable in place :
+/// copies share their data with the input until written to, at which point the whole vector
+/// is duplicated serially before being overwritten.
+template<typename DataType, typename Functor>
+typename DataType::Ptr transformElements( const DataType *data, Functor &&functor, size_t grainSize = defaultGrainSize );
+
+/// Transforms all the Point, Vector and Normal primitive variables of `primitive` in
+/// parallel, replacing their data with newly allocated data. Data which is not transformed
+/// continues to be shared with any copies of the primitive. Points are transformed by the full matrix, Vectors by its
+/// rotation and scale, and Normals by its inverse transpose. Primitive variables
+/// with other interpretations are left unchanged.
+GAFFERSCENE_API void transformPrimitiveVariables( IECoreScene::Primitive *primitive, const Imath::M44f &matrix, size_t grainSize = defaultGrainSize );
+
+} // namespace PrimitiveVariableAlgo
+
+} // namespace GafferScene
+
+#include "GafferScene/PrimitiveVariableAlgo.inl"
+
+#endif // GAFFERSCENE_PRIMITIVEVARIABLEALGO_H
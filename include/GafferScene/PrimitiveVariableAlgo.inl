@@ -0,0 +1,125 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2026, Image Engine Design Inc. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "Gaffer/Context.h"
+
+#include "IECore/Canceller.h"
+#include "IECore/GeometricTypedData.h"
+
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+
+namespace GafferScene
+{
+
+namespace PrimitiveVariableAlgo
+{
+
+template<typename Functor>
+void parallelProcessElements( size_t size, Functor &&functor, size_t grainSize )
+{
+	if( !size )
+	{
+		return;
+	}
+
+	// The current context is thread local, so we must fetch the
+	// canceller now, rather than from within the tasks.
+	const IECore::Canceller *canceller = Gaffer::Context::current()->canceller();
+
+	if( size <= grainSize )
+	{
+		// Not worth the overhead of launching tasks.
+		IECore::Canceller::check( canceller );
+		functor( size_t( 0 ), size );
+		return;
+	}
+
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, size, grainSize ),
+		[&]( const tbb::blocked_range<size_t> &range ) {
+			IECore::Canceller::check( canceller );
+			functor( range.begin(), range.end() );
+		},
+		taskGroupContext
+	);
+}
+
+namespace Detail
+{
+
+template<typename T>
+void copyInterpretation( const IECore::GeometricTypedData<T> *from, IECore::GeometricTypedData<T> *to )
+{
+	to->setInterpretation( from->getInterpretation() );
+}
+
+inline void copyInterpretation( const IECore::Data *from, IECore::Data *to )
+{
+}
+
+} // namespace Detail
+
+template<typename DataType, typename Functor>
+typename DataType::Ptr transformElements( const DataType *data, Functor &&functor, size_t grainSize )
+{
+	typename DataType::Ptr result = new DataType;
+	Detail::copyInterpretation( data, result.get() );
+
+	const auto &input = data->readable();
+	auto &output = result->writable();
+	output.resize( input.size() );
+
+	const auto *in = input.data();
+	auto *out = output.data();
+	parallelProcessElements(
+		input.size(),
+		[in, out, &functor]( size_t begin, size_t end ) {
+			for( size_t i = begin; i < end; ++i )
+			{
+				out[i] = functor( in[i] );
+			}
+		},
+		grainSize
+	);
+
+	return result;
+}
+
+} // namespace PrimitiveVariableAlgo
+
+} // namespace GafferScene
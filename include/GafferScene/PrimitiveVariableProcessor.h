@@ -81,6 +81,15 @@ class GAFFERSCENE_API PrimitiveVariableProcessor : public SceneElementProcessor
 		IECore::ConstObjectPtr computeProcessedObject( const ScenePath &path, const Gaffer::Context *context, IECore::ConstObjectPtr inputObject ) const override;
 
 		/// Must be implemented by subclasses to process the primitive variable in place.
+		/// The variable's data is shared with the input primitive, so implementations
+		/// which compute new values should assign new data to the variable rather than
+		/// modifying the `writable()` contents of the existing data, which would
+		/// duplicate it first.
+		///
+		/// > Note : This is called concurrently for the different variables of
+		/// > a primitive, so implementations must be thread-safe. They may read
+		/// > `inputGeometry` freely, but must not modify any state other than
+		/// > `inputVariable`.
 		virtual void processPrimitiveVariable( const ScenePath &path, const Gaffer::Context *context, IECoreScene::ConstPrimitivePtr inputGeometry, IECoreScene::PrimitiveVariable &inputVariable ) const = 0;
 
 	private :
@@ -50,6 +50,7 @@ namespace GafferScene
 {
 
 IE_CORE_FORWARDDECLARE( ScenePlug )
+IE_CORE_FORWARDDECLARE( SceneNode )
 
 /// Utility class used to make interactive updates to a Renderer.
 class GAFFERSCENE_API RenderController : public boost::signals::trackable
@@ -99,10 +100,13 @@ class GAFFERSCENE_API RenderController : public boost::signals::trackable
 		};
 
 		void plugDirtied( const Gaffer::Plug *plug );
+		void sourcePlugDirtied( const Gaffer::Plug *plug );
+		void updateSourceNode();
 		void contextChanged( const IECore::InternedString &name );
 		void requestUpdate();
 		void dirtyGlobals( unsigned components );
 		void dirtySceneGraphs( unsigned components );
+		void dirtySceneGraphs( unsigned components, const IECore::PathMatcher &paths );
 
 		void updateInternal( const ProgressCallback &callback = ProgressCallback(), const IECore::PathMatcher *pathsToUpdate = nullptr );
 		void updateDefaultCamera();
@@ -119,17 +123,39 @@ class GAFFERSCENE_API RenderController : public boost::signals::trackable
 		size_t m_minimumExpansionDepth;
 
 		boost::signals::scoped_connection m_plugDirtiedConnection;
+		boost::signals::scoped_connection m_sourcePlugDirtiedConnection;
 		boost::signals::scoped_connection m_contextChangedConnection;
 
 		UpdateRequiredSignal m_updateRequiredSignal;
 		bool m_updateRequired;
 		bool m_updateRequested;
 
+		// The node providing `m_scene`, and the locations it has reported
+		// as affected by the edits in the current round of dirty propagation.
+		// Dirty signals for the source node are emitted before those for
+		// `m_scene`, so we accumulate these as the source node is dirtied,
+		// and consume them when `m_scene` is dirtied.
+		enum EditedPathsState
+		{
+			NoEditedPaths,
+			SomeEditedPaths,
+			AllEditedPaths
+		};
+		const SceneNode *m_sourceNode;
+		EditedPathsState m_editedPathsState;
+		IECore::PathMatcher m_editedPaths;
+
 		std::vector<std::unique_ptr<SceneGraph> > m_sceneGraphs;
+		// The locations which need visiting on the next call to `update()`.
+		// When `m_allPathsDirty` is false, we can limit our traversal to
+		// `m_dirtyPaths`.
+		bool m_allPathsDirty;
+		IECore::PathMatcher m_dirtyPaths;
 		unsigned m_dirtyGlobalComponents;
 		unsigned m_changedGlobalComponents;
 		IECore::ConstCompoundObjectPtr m_globals;
 		RendererAlgo::RenderSets m_renderSets;
+		RendererAlgo::ObjectCache m_objectCache;
 		IECoreScenePreview::Renderer::ObjectInterfacePtr m_defaultCamera;
 		IECoreScenePreview::Renderer::AttributesInterfacePtr m_boundAttributes;
 
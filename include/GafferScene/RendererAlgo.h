@@ -48,6 +48,7 @@
 #include "boost/container/flat_map.hpp"
 
 #include <functional>
+#include <memory>
 
 namespace IECoreScenePreview
 {
@@ -79,6 +80,43 @@ GAFFERSCENE_API void transformSamples( const ScenePlug *scene, size_t segments,
 /// object types cannot be interpolated anyway.
 GAFFERSCENE_API void objectSamples( const ScenePlug *scene, size_t segments, const Imath::V2f &shutter, std::vector<IECoreScene::ConstVisibleRenderablePtr> &samples, std::set<float> &sampleTimes );
 
+/// Utility class used to share objects between locations whose objects have
+/// identical hashes, as is common after instancing or duplication. Objects
+/// are held by the cache from the first time they are seen, and returned for
+/// all subsequent locations with the same hash without further computation,
+/// so that renderer backends receive the same object and can convert it once
+/// and instance it. Objects are stored atomically, so locations with equal
+/// hashes receive the same object even when they are output concurrently.
+/// Once the objects held reach a memory limit, further objects are returned
+/// without being held, and are not shared. All methods may be called
+/// concurrently.
+class GAFFERSCENE_API ObjectCache : boost::noncopyable
+{
+
+	public :
+
+		/// The memory limit applies separately to the objects and the
+		/// object samples held by the cache.
+		ObjectCache( size_t memoryLimit = 1024 * 1024 * 1024 );
+		~ObjectCache();
+
+		/// Returns the object at the current location. The hash must be
+		/// `scene->objectPlug()->hash()`, which callers typically have already.
+		IECore::ConstObjectPtr object( const ScenePlug *scene, const IECore::MurmurHash &hash );
+		/// As for `RendererAlgo::objectSamples()`, but sharing samples between
+		/// locations with identical object hashes at all sample times.
+		void objectSamples( const ScenePlug *scene, size_t segments, const Imath::V2f &shutter, std::vector<IECoreScene::ConstVisibleRenderablePtr> &samples, std::set<float> &sampleTimes );
+
+		/// Releases all the objects held by the cache.
+		void clear();
+
+	private :
+
+		struct Entries;
+		std::unique_ptr<Entries> m_entries;
+
+};
+
 /// Function to return a SceneProcessor used to adapt the
 /// scene for rendering.
 typedef std::function<SceneProcessorPtr ()> Adaptor;
@@ -61,6 +61,9 @@ class GAFFERSCENE_API SceneElementProcessor : public FilteredSceneProcessor
 
 		/// Implemented so that each child of inPlug() affects the corresponding child of outPlug()
 		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
+		/// Implemented to return the known matches of the filter for edits to
+		/// plugs other than the input scene and the filter.
+		bool affectedPaths( const Gaffer::Plug *input, IECore::PathMatcher &paths ) const override;
 
 	protected :
 
@@ -70,6 +70,15 @@ class GAFFERSCENE_API SceneNode : public Gaffer::ComputeNode
 		/// Implemented so that enabledPlug() affects outPlug().
 		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
 
+		/// May be implemented by derived classes to return true and fill `paths`
+		/// when it is known that dirtying `input` can only change the bound,
+		/// transform, attributes and object of the locations in `paths` and their
+		/// descendants (and the bounds of their ancestors). This allows clients
+		/// such as the RenderController to limit their updates to the affected
+		/// parts of the scene. The default implementation returns false, meaning
+		/// that any location may be affected.
+		virtual bool affectedPaths( const Gaffer::Plug *input, IECore::PathMatcher &paths ) const;
+
 	protected :
 
 		typedef ScenePlug::ScenePath ScenePath;
@@ -65,6 +65,9 @@ class GAFFERSCENE_API Seeds : public BranchCreator
 		Gaffer::StringPlug *pointTypePlug();
 		const Gaffer::StringPlug *pointTypePlug() const;
 
+		Gaffer::IntPlug *maxPointsPlug();
+		const Gaffer::IntPlug *maxPointsPlug() const;
+
 		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
 
 	protected :
@@ -149,6 +149,10 @@ enum TypeId
 	PrimitiveVariableExistsTypeId = 110604,
 	CollectTransformsTypeId = 110605,
 	CameraTweaksTypeId = 110606,
+	InstancerCapsuleTypeId = 110607,
+	LevelOfDetailTypeId = 110608,
+	FrustumCullTypeId = 110609,
+	CameraVisibilityProcessorTypeId = 110610,
 
 	PreviewGeometryTypeId = 110648,
 	PreviewProceduralTypeId = 110649,
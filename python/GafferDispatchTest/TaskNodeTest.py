@@ -35,8 +35,10 @@
 ##########################################################################
 
 import os
+import time
 import unittest
 import itertools
+import threading
 
 import IECore
 
@@ -170,6 +172,84 @@ class TaskNodeTest( GafferTest.TestCase ) :
 		n2["task"].executeSequence( [ 1, 5, 10 ] )
 		self.assertEqual( len( n2.log ), 2 )
 
+	def testExecuteSequenceWithFrameConcurrency( self ) :
+
+		class ConcurrentTaskNode( GafferDispatch.TaskNode ) :
+
+			def __init__( self, name = "ConcurrentTaskNode" ) :
+
+				GafferDispatch.TaskNode.__init__( self, name )
+				self.addFrameConcurrencyPlug()
+
+				self.log = []
+				self.active = 0
+				self.peakActive = 0
+				self.lock = threading.Lock()
+
+			def canExecuteFramesConcurrently( self ) :
+
+				return True
+
+			def execute( self ) :
+
+				context = Gaffer.Context( Gaffer.Context.current() )
+				with self.lock :
+					self.active += 1
+					self.peakActive = max( self.peakActive, self.active )
+
+				# Sleeping releases the GIL, allowing other
+				# frames to start in the meantime.
+				time.sleep( 0.1 )
+
+				with self.lock :
+					self.active -= 1
+					self.log.append( context )
+
+			def hash( self, context ) :
+
+				h = GafferDispatch.TaskNode.hash( self, context )
+				h.append( context.getFrame() )
+				return h
+
+		n = ConcurrentTaskNode()
+		self.assertEqual( n["dispatcher"]["frameConcurrency"].getValue(), 1 )
+
+		# Frames are executed serially by default.
+
+		n["task"].executeSequence( range( 1, 5 ) )
+		self.assertEqual( len( n.log ), 4 )
+		self.assertEqual( n.peakActive, 1 )
+
+		# But may overlap when we increase the concurrency.
+
+		del n.log[:]
+		n["dispatcher"]["frameConcurrency"].setValue( 4 )
+
+		c = Gaffer.Context()
+		c["test"] = "value"
+		with c :
+			n["task"].executeSequence( range( 1, 21 ) )
+
+		self.assertEqual( len( n.log ), 20 )
+		self.assertEqual( sorted( l.getFrame() for l in n.log ), range( 1, 21 ) )
+		for l in n.log :
+			self.assertEqual( l["test"], "value" )
+
+		self.assertGreater( n.peakActive, 1 )
+		self.assertLessEqual( n.peakActive, 4 )
+
+	def testFrameConcurrencyIsOptIn( self ) :
+
+		# Nodes must opt in to concurrent execution, since
+		# in general `execute()` isn't threadsafe.
+
+		n = GafferDispatchTest.LoggingTaskNode()
+		self.assertNotIn( "frameConcurrency", n["dispatcher"] )
+		self.assertFalse( n.canExecuteFramesConcurrently() )
+
+		self.assertNotIn( "frameConcurrency", GafferDispatch.SystemCommand()["dispatcher"] )
+		self.assertNotIn( "frameConcurrency", GafferDispatch.PythonCommand()["dispatcher"] )
+
 	def testRequiresSequenceExecution( self ) :
 
 		n = GafferDispatchTest.LoggingTaskNode()
@@ -143,6 +143,19 @@ Gaffer.Metadata.registerNode(
 
 		),
 
+		"dispatcher.frameConcurrency" : (
+
+			"description",
+			"""
+			Maximum number of frames of a batch to execute concurrently. Increasing
+			this can make better use of machines with many cores, at the expense
+			of greater memory usage. Frames share the same compute cache, so the
+			cache limit should be large enough to hold the data for all the
+			frames being executed at once.
+			""",
+
+		),
+
 		"dispatcher.immediate" : (
 
 			"description",
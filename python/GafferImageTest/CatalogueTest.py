@@ -609,6 +609,47 @@ class CatalogueTest( GafferImageTest.ImageTestCase ) :
 		with self.assertRaisesRegexp( RuntimeError, "Could not open file" ) :
 			s["c"]["out"].image()
 
+	def testIdenticalImagesShareFile( self ) :
+
+		s = Gaffer.ScriptNode()
+		s["c"] = GafferImage.Catalogue()
+		s["c"]["directory"].setValue( os.path.join( self.temporaryDirectory(), "catalogue" ) )
+
+		r = GafferImage.ImageReader()
+		r["fileName"].setValue( "${GAFFER_ROOT}/python/GafferImageTest/images/blurRange.exr" )
+
+		self.sendImage( r["out"], s["c"] )
+		self.sendImage( r["out"], s["c"] )
+
+		# Each image is received by a separate Display, but because the
+		# contents are identical, only a single file should have been saved.
+
+		self.assertEqual( len( s["c"]["images"] ), 2 )
+		fileName = s["c"]["images"][0]["fileName"].getValue()
+		self.assertEqual( s["c"]["images"][1]["fileName"].getValue(), fileName )
+		self.assertEqual( os.listdir( s["c"]["directory"].getValue() ), [ os.path.basename( fileName ) ] )
+
+		s["c"]["imageIndex"].setValue( 1 )
+		self.assertImagesEqual( s["c"]["out"], r["out"], ignoreMetadata = True, maxDifference = 0.0003 )
+
+	def testGenerateFileNameFromHash( self ) :
+
+		c = GafferImage.Catalogue()
+		c["directory"].setValue( os.path.join( self.temporaryDirectory(), "catalogue" ) )
+
+		constant = GafferImage.Constant()
+		grade = GafferImage.Grade()
+		grade["in"].setInput( constant["out"] )
+
+		# Generating the file name is done on the UI thread,
+		# so must not compute any pixels.
+
+		with Gaffer.PerformanceMonitor() as monitor :
+			fileName = c.generateFileName( grade["out"] )
+
+		self.assertEqual( os.path.basename( fileName ), grade["out"].imageHash().toString() + ".exr" )
+		self.assertEqual( monitor.plugStatistics( grade["out"]["channelData"] ).computeCount, 0 )
+
 	def testDeleteKeepsOrder( self ) :
 
 		# Send 4 images to a Catalogue : red, green, blue, yellow
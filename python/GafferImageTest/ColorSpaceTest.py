@@ -254,5 +254,55 @@ class ColorSpaceTest( GafferImageTest.ImageTestCase ) :
 
 		self.assertEqual( c2["out"].channelData( "R", imath.V2i( 0 ) ), c1["out"].channelData( "R", imath.V2i( 0 ) ) )
 
+	def testConstantTiles( self ) :
+
+		# Checks are 128 pixels wide, offset by 20 pixels. So the
+		# tile at 64, 64 lies entirely within a check and is constant,
+		# while the tile at 0, 0 contains both colours.
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 512, 512 ) )
+		checker["size"].setValue( imath.V2f( 128 ) )
+		checker["colorA"].setValue( imath.Color4f( 0.25, 0.5, 0.75, 1 ) )
+		checker["colorB"].setValue( imath.Color4f( 0.1, 0.2, 0.3, 1 ) )
+		checker["transform"]["translate"].setValue( imath.V2f( 20 ) )
+
+		colorSpace = GafferImage.ColorSpace()
+		colorSpace["in"].setInput( checker["out"] )
+		colorSpace["inputSpace"].setValue( "linear" )
+		colorSpace["outputSpace"].setValue( "sRGB" )
+
+		constantTileOrigin = imath.V2i( 64 )
+		edgeTileOrigin = imath.V2i( 0 )
+		# Index of a pixel within the edge tile which has the same
+		# colour as the constant tile.
+		edgeIndex = 30 * GafferImage.ImagePlug.tileSize() + 30
+
+		for channel in [ "R", "G", "B" ] :
+
+			inputConstantTile = checker["out"].channelData( channel, constantTileOrigin )
+			inputEdgeTile = checker["out"].channelData( channel, edgeTileOrigin )
+			self.assertEqual( len( set( inputConstantTile ) ), 1 )
+			self.assertGreater( len( set( inputEdgeTile ) ), 1 )
+			self.assertEqual( inputEdgeTile[edgeIndex], inputConstantTile[0] )
+
+			constantTile = colorSpace["out"].channelData( channel, constantTileOrigin )
+			edgeTile = colorSpace["out"].channelData( channel, edgeTileOrigin )
+
+			# The constant tile is converted as a whole, and remains constant.
+
+			self.assertEqual( len( constantTile ), len( inputConstantTile ) )
+			self.assertEqual( len( set( constantTile ) ), 1 )
+
+			# Linear values below 1 are brightened by the conversion to sRGB.
+
+			self.assertGreater( constantTile[0], inputConstantTile[0] )
+
+			# And the conversion must match that applied pixel by pixel to a
+			# tile which isn't constant.
+
+			self.assertGreater( len( set( edgeTile ) ), 1 )
+			self.assertEqual( edgeTile[edgeIndex], constantTile[0] )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -205,5 +205,22 @@ class ConstantTest( GafferImageTest.ImageTestCase ) :
 
 		self.assertTrue( c["out"]["channelNames"] in set( [ x[0] for x in cs ] ) )
 
+	def testTilesAreShared( self ) :
+
+		c1 = GafferImage.Constant()
+		c1["format"].setValue( GafferImage.Format( 200, 200 ) )
+		c1["color"].setValue( imath.Color4f( 0.25, 0.5, 0.75, 1 ) )
+
+		c2 = GafferImage.Constant()
+		c2["format"].setValue( GafferImage.Format( 100, 100 ) )
+		c2["color"].setValue( imath.Color4f( 0.25, 0.5, 0.75, 1 ) )
+
+		tile = c1["out"].channelData( "R", imath.V2i( 0 ), _copy = False )
+		self.assertEqual( tile, IECore.FloatVectorData( [ 0.25 ] * GafferImage.ImagePlug.tileSize() ** 2 ) )
+		self.assertTrue( tile.isSame( c1["out"].channelData( "R", imath.V2i( GafferImage.ImagePlug.tileSize() ), _copy = False ) ) )
+		self.assertTrue( tile.isSame( c2["out"].channelData( "R", imath.V2i( 0 ), _copy = False ) ) )
+		self.assertFalse( tile.isSame( c1["out"].channelData( "G", imath.V2i( 0 ), _copy = False ) ) )
+
+
 if __name__ == "__main__":
 	unittest.main()
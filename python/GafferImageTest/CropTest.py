@@ -276,5 +276,30 @@ class CropTest( GafferImageTest.ImageTestCase ) :
 		crop["format"].setValue( GafferImage.Format( 100, 200 ) )
 		self.assertIn( crop["out"]["dataWindow"], { x[0] for x in cs } )
 
+	def testResolutionLevel( self ) :
+
+		constant = GafferImage.Constant()
+		constant["format"].setValue( GafferImage.Format( 100, 100 ) )
+
+		crop = GafferImage.Crop()
+		crop["in"].setInput( constant["out"] )
+
+		with Gaffer.Context() as context :
+
+			context["image:resolutionLevel"] = 1
+
+			crop["areaSource"].setValue( GafferImage.Crop.AreaSource.DisplayWindow )
+			self.assertEqual( crop["out"]["format"].getValue(), GafferImage.Format( 50, 50 ) )
+			self.assertEqual( crop["out"]["dataWindow"].getValue(), imath.Box2i( imath.V2i( 0 ), imath.V2i( 50 ) ) )
+
+			crop["affectDisplayWindow"].setValue( False )
+			self.assertEqual( crop["out"]["format"].getValue(), GafferImage.Format( 50, 50 ) )
+
+			crop["affectDisplayWindow"].setValue( True )
+			crop["areaSource"].setValue( GafferImage.Crop.AreaSource.Area )
+			crop["area"].setValue( imath.Box2i( imath.V2i( 20 ), imath.V2i( 60 ) ) )
+			self.assertEqual( crop["out"]["format"].getValue(), GafferImage.Format( 20, 20 ) )
+			self.assertEqual( crop["out"]["dataWindow"].getValue(), imath.Box2i( imath.V2i( 0 ), imath.V2i( 20 ) ) )
+
 if __name__ == "__main__":
 	unittest.main()
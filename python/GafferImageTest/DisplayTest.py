@@ -184,6 +184,46 @@ class DisplayTest( GafferImageTest.ImageTestCase ) :
 
 		driver.close()
 
+	def testHashesDependOnTileContents( self ) :
+
+		node = GafferImage.Display()
+		server = IECoreImage.DisplayDriverServer()
+		driverCreatedConnection = GafferImage.Display.driverCreatedSignal().connect( lambda driver, parameters : node.setDriver( driver ) )
+
+		tileSize = GafferImage.ImagePlug.tileSize()
+		dataWindow = imath.Box2i( imath.V2i( 0 ), imath.V2i( tileSize * 2, tileSize ) )
+		driver = self.Driver(
+			GafferImage.Format( dataWindow ),
+			dataWindow,
+			[ "Y" ],
+			port = server.portNumber(),
+		)
+
+		tile1 = imath.Box2i( imath.V2i( 0 ), imath.V2i( tileSize ) )
+		tile2 = imath.Box2i( imath.V2i( tileSize, 0 ), imath.V2i( tileSize * 2, tileSize ) )
+
+		driver.sendBucket( tile1, [ IECore.FloatVectorData( [ 1 ] * tileSize * tileSize ) ] )
+		h1 = node["out"].channelDataHash( "Y", tile1.min() )
+
+		# A tile which isn't sent data keeps its hash when
+		# another tile is updated.
+
+		driver.sendBucket( tile2, [ IECore.FloatVectorData( [ 2 ] * tileSize * tileSize ) ] )
+		self.assertEqual( node["out"].channelDataHash( "Y", tile1.min() ), h1 )
+		h2 = node["out"].channelDataHash( "Y", tile2.min() )
+
+		# Resending identical data doesn't change the hash,
+		# but sending new data does.
+
+		driver.sendBucket( tile2, [ IECore.FloatVectorData( [ 2 ] * tileSize * tileSize ) ] )
+		self.assertEqual( node["out"].channelDataHash( "Y", tile2.min() ), h2 )
+
+		driver.sendBucket( tile2, [ IECore.FloatVectorData( [ 3 ] * tileSize * tileSize ) ] )
+		self.assertNotEqual( node["out"].channelDataHash( "Y", tile2.min() ), h2 )
+		self.assertEqual( node["out"].channelDataHash( "Y", tile1.min() ), h1 )
+
+		driver.close()
+
 	def testTransferChecker( self ) :
 
 		self.__testTransferImage( "$GAFFER_ROOT/python/GafferImageTest/images/checker.exr" )
@@ -274,6 +314,38 @@ class DisplayTest( GafferImageTest.ImageTestCase ) :
 
 		driver.close()
 
+	def testDataReceivedOnlyDirtiesChannelData( self ) :
+
+		driversCreated = GafferTest.CapturingSlot( GafferImage.Display.driverCreatedSignal() )
+
+		server = IECoreImage.DisplayDriverServer()
+		dataWindow = imath.Box2i( imath.V2i( 0 ), imath.V2i( 100 ) )
+
+		driver = self.Driver(
+			GafferImage.Format( dataWindow ),
+			dataWindow,
+			[ "Y" ],
+			port = server.portNumber()
+		)
+
+		display = GafferImage.Display()
+		dirtiedPlugs = GafferTest.CapturingSlot( display.plugDirtiedSignal() )
+
+		display.setDriver( driversCreated[0][0] )
+		self.assertIn( display["out"]["format"], { x[0] for x in dirtiedPlugs } )
+		self.assertIn( display["out"]["dataWindow"], { x[0] for x in dirtiedPlugs } )
+		self.assertIn( display["out"]["channelNames"], { x[0] for x in dirtiedPlugs } )
+
+		del dirtiedPlugs[:]
+		driver.sendBucket( dataWindow, [ IECore.FloatVectorData( [ 0.5 ] * dataWindow.size().x * dataWindow.size().y ) ] )
+
+		dirtied = { x[0] for x in dirtiedPlugs }
+		self.assertIn( display["out"]["channelData"], dirtied )
+		for n in ( "format", "dataWindow", "metadata", "channelNames" ) :
+			self.assertNotIn( display["out"][n], dirtied )
+
+		driver.close()
+
 	def __testTransferImage( self, fileName ) :
 
 		imageReader = GafferImage.ImageReader()
@@ -111,6 +111,22 @@ class FormatPlugTest( GafferImageTest.ImageTestCase ) :
 			self.assertEqual( GafferImage.FormatPlug.getDefaultFormat( context ), f )
 			self.assertEqual( constant["out"]["format"].getValue(), f )
 
+	def testResolutionLevel( self ) :
+
+		constant = GafferImage.Constant()
+		constant["format"].setValue( GafferImage.Format( imath.Box2i( imath.V2i( -5, 10 ), imath.V2i( 195, 111 ) ), 2 ) )
+
+		with Gaffer.Context() as context :
+
+			fullHash = constant["out"]["format"].hash()
+
+			context["image:resolutionLevel"] = 1
+			f = constant["out"]["format"].getValue()
+			self.assertEqual( f.getDisplayWindow(), imath.Box2i( imath.V2i( -3, 5 ), imath.V2i( 98, 56 ) ) )
+			self.assertEqual( f.getPixelAspect(), 2 )
+			self.assertEqual( constant["out"]["dataWindow"].getValue(), f.getDisplayWindow() )
+			self.assertNotEqual( constant["out"]["format"].hash(), fullHash )
+
 	def testAcquireDefaultFormatPlug( self ) :
 
 		s1 = Gaffer.ScriptNode()
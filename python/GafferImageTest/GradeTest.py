@@ -248,3 +248,30 @@ class GradeTest( GafferImageTest.ImageTestCase ) :
 
 		sampler["channels"].setValue( IECore.StringVectorData( [ "B.R", "B.G", "B.B", "B.A" ] ) )
 		self.assertEqual( sampler["color"].getValue(), imath.Color4f( 1 ) )
+
+	def testConstantInput( self ) :
+
+		# Grade a checkerboard, so that we get a mix of
+		# constant tiles and tiles with edges in them.
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 512, 512 ) )
+		checker["size"].setValue( imath.V2f( 128 ) )
+		checker["colorA"].setValue( imath.Color4f( 0.25, 0.5, 0.75, 1 ) )
+		checker["colorB"].setValue( imath.Color4f( 0.1, 0.2, 0.3, 1 ) )
+		checker["transform"]["translate"].setValue( imath.V2f( 20 ) )
+
+		grade = GafferImage.Grade()
+		grade["in"].setInput( checker["out"] )
+		grade["gamma"].setValue( imath.Color4f( 2.2, 1.5, 0.8, 1 ) )
+		grade["gain"].setValue( imath.Color4f( 1.5, 2, 3, 1 ) )
+
+		constantTile = grade["out"].channelData( "R", imath.V2i( 64 ) )
+		self.assertEqual( len( set( constantTile ) ), 1 )
+
+		# The constant tiles must match the same values
+		# computed in tiles which aren't constant.
+
+		edgeTile = grade["out"].channelData( "R", imath.V2i( 0 ) )
+		self.assertGreater( len( set( edgeTile ) ), 1 )
+		self.assertIn( constantTile[0], edgeTile )
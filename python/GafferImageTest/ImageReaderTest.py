@@ -459,5 +459,26 @@ class ImageReaderTest( GafferImageTest.ImageTestCase ) :
 
 		self.assertImagesEqual( reader["out"], constant["out"] )
 
+	def testResolutionLevel( self ) :
+
+		constant = GafferImage.Constant()
+		constant["format"].setValue( GafferImage.Format( 64, 64 ) )
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( constant["out"] )
+		writer["fileName"].setValue( os.path.join( self.temporaryDirectory(), "constant.exr" ) )
+		writer["task"].execute()
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setInput( writer["fileName"] )
+
+		with Gaffer.Context() as context :
+
+			# The format is reduced by the OpenImageIOReader, and
+			# must not be reduced again by the ImageReader.
+			context["image:resolutionLevel"] = 2
+			self.assertEqual( reader["out"]["format"].getValue(), GafferImage.Format( 16, 16 ) )
+			self.assertEqual( reader["out"]["dataWindow"].getValue(), imath.Box2i( imath.V2i( 0 ), imath.V2i( 16 ) ) )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -93,5 +93,25 @@ class ImageSamplerTest( GafferImageTest.ImageTestCase ) :
 		sampler["channels"].setValue( IECore.StringVectorData( [ "diffuse.R", "diffuse.G", "diffuse.B", "diffuse.A" ] ) )
 		self.assertEqual( sampler["color"].getValue(), imath.Color4f( 1, 0.5, 0.25, 1 ) )
 
+	def testResolutionLevel( self ) :
+
+		ramp = GafferImage.Ramp()
+		ramp["format"].setValue( GafferImage.Format( 100, 100 ) )
+		ramp["startPosition"].setValue( imath.V2f( 0, 50 ) )
+		ramp["endPosition"].setValue( imath.V2f( 100, 50 ) )
+
+		sampler = GafferImage.ImageSampler()
+		sampler["image"].setInput( ramp["out"] )
+		sampler["pixel"].setValue( imath.V2f( 30, 50 ) )
+
+		full = sampler["color"].getValue()
+		self.assertGreater( full.r, 0 )
+
+		# The pixel is specified at full resolution, so should
+		# sample the same part of the ramp at any level.
+		with Gaffer.Context() as context :
+			context["image:resolutionLevel"] = 1
+			self.assertAlmostEqual( sampler["color"].getValue().r, full.r, places = 2 )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -40,6 +40,7 @@ import imath
 
 import IECore
 
+import Gaffer
 import GafferTest
 import GafferImage
 import GafferImageTest
@@ -169,6 +170,24 @@ class ImageStatsTest( GafferImageTest.ImageTestCase ) :
 
 		self.assertEqual( s["max"]["r"].getValue(), 0 )
 
+	def testResolutionLevel( self ) :
+
+		c = GafferImage.Constant()
+		c["format"].setValue( GafferImage.Format( 100, 100 ) )
+		c["color"].setValue( imath.Color4f( 1 ) )
+
+		s = GafferImage.ImageStats()
+		s["in"].setInput( c["out"] )
+		# Half of the area lies outside the image, where pixels
+		# count as black.
+		s["area"].setValue( imath.Box2i( imath.V2i( 0 ), imath.V2i( 200, 100 ) ) )
+
+		self.assertEqual( s["average"]["r"].getValue(), 0.5 )
+
+		with Gaffer.Context() as context :
+			context["image:resolutionLevel"] = 2
+			self.assertEqual( s["average"]["r"].getValue(), 0.5 )
+
 	def testFormatAndMetadataAffectNothing( self ) :
 
 		s = GafferImage.ImageStats()
@@ -187,6 +206,111 @@ class ImageStatsTest( GafferImageTest.ImageTestCase ) :
 		self.assertEqual( s["min"].getValue(), imath.Color4f( 1 ) )
 		self.assertEqual( s["max"].getValue(), imath.Color4f( 1 ) )
 
+	def testHistogram( self ) :
+
+		c = GafferImage.Constant()
+		c["color"].setValue( imath.Color4f( 0.25, 0.5, 0.75, 1 ) )
+
+		s = GafferImage.ImageStats()
+		s["in"].setInput( c["out"] )
+		s["area"].setValue( imath.Box2i( imath.V2i( 10 ), imath.V2i( 110 ) ) )
+
+		for i, bin in enumerate( [ 64, 128, 192, 255 ] ) :
+			h = s["histogram"][i].getValue()
+			self.assertEqual( len( h ), 256 )
+			self.assertEqual( h[bin], 10000 )
+			self.assertEqual( sum( h ), 10000 )
+
+		s["histogramBins"].setValue( 4 )
+		for i, bin in enumerate( [ 1, 2, 3, 3 ] ) :
+			h = s["histogram"][i].getValue()
+			self.assertEqual( len( h ), 4 )
+			self.assertEqual( h[bin], 10000 )
+
+		# Pixels outside the data window count as zero.
+
+		s["area"].setValue( imath.Box2i( imath.V2i( -100 ), imath.V2i( 100 ) ) )
+		h = s["histogram"]["r"].getValue()
+		self.assertEqual( h[0], 30000 )
+		self.assertEqual( h[1], 10000 )
+
+	def testPercentile( self ) :
+
+		r = GafferImage.Ramp()
+		r["format"].setValue( GafferImage.Format( 100, 100 ) )
+		r["endPosition"].setValue( imath.V2f( 100, 0 ) )
+
+		s = GafferImage.ImageStats()
+		s["in"].setInput( r["out"] )
+		s["area"].setValue( imath.Box2i( imath.V2i( 0 ), imath.V2i( 100 ) ) )
+		s["histogramBins"].setValue( 1024 )
+
+		s["percentile"].setValue( 0 )
+		self.assertEqual( s["percentileValue"].getValue(), s["min"].getValue() )
+
+		s["percentile"].setValue( 100 )
+		self.assertEqual( s["percentileValue"].getValue(), s["max"].getValue() )
+
+		image = r["out"].image()
+		for percentile in ( 10, 50, 90 ) :
+			s["percentile"].setValue( percentile )
+			for i, channelName in enumerate( [ "R", "G", "B", "A" ] ) :
+				values = sorted( image[channelName].data )
+				expected = values[ int( len( values ) * percentile / 100.0 ) ]
+				self.assertAlmostEqual( s["percentileValue"][i].getValue(), expected, delta = 0.02 )
+
+	def testTileStatsReusedWhenAreaMoves( self ) :
+
+		c = GafferImage.Checkerboard()
+		c["format"].setValue( GafferImage.Format( 512, 512 ) )
+
+		s = GafferImage.ImageStats()
+		s["in"].setInput( c["out"] )
+		s["area"].setValue( imath.Box2i( imath.V2i( 10 ), imath.V2i( 300 ) ) )
+
+		def tileStatsHash( tileOrigin ) :
+			with Gaffer.Context() as context :
+				context["image:channelName"] = "R"
+				context["image:tileOrigin"] = tileOrigin
+				return s["__tileStats"].hash()
+
+		interiorHash = tileStatsHash( imath.V2i( 128 ) )
+		edgeHash = tileStatsHash( imath.V2i( 0 ) )
+
+		s["area"].setValue( imath.Box2i( imath.V2i( 20 ), imath.V2i( 310 ) ) )
+		self.assertEqual( tileStatsHash( imath.V2i( 128 ) ), interiorHash )
+		self.assertNotEqual( tileStatsHash( imath.V2i( 0 ) ), edgeHash )
+
+	def testTileBoundaries( self ) :
+
+		c = GafferImage.Checkerboard()
+		c["format"].setValue( GafferImage.Format( 300, 200 ) )
+
+		s = GafferImage.ImageStats()
+		s["in"].setInput( c["out"] )
+
+		image = c["out"].image()
+		for area in [
+			imath.Box2i( imath.V2i( 0 ), imath.V2i( 300, 200 ) ),
+			imath.Box2i( imath.V2i( 63 ), imath.V2i( 129, 65 ) ),
+			imath.Box2i( imath.V2i( -10, 5 ), imath.V2i( 70, 250 ) ),
+		] :
+			s["area"].setValue( area )
+			for i, channelName in enumerate( [ "R", "G", "B", "A" ] ) :
+				values = []
+				data = image[channelName].data
+				for y in range( area.min().y, area.max().y ) :
+					for x in range( area.min().x, area.max().x ) :
+						if x < 0 or y < 0 or x >= 300 or y >= 200 :
+							values.append( 0 )
+						else :
+							# ImagePrimitive has a flipped Y axis
+							values.append( data[ ( 199 - y ) * 300 + x ] )
+
+				self.assertAlmostEqual( s["min"][i].getValue(), min( values ) )
+				self.assertAlmostEqual( s["max"][i].getValue(), max( values ) )
+				self.assertAlmostEqual( s["average"][i].getValue(), sum( values ) / len( values ), places = 5 )
+
 	def __assertColour( self, colour1, colour2 ) :
 		for i in range( 0, 4 ):
 			self.assertEqual( "%.4f" % colour2[i], "%.4f" % colour1[i] )
@@ -1232,5 +1232,139 @@ class ImageWriterTest( GafferImageTest.ImageTestCase ) :
 		cleanOutput["channels"].setValue( "A" )
 		self.assertImagesEqual( reader["out"], cleanOutput["out"], ignoreMetadata=True, ignoreDataWindow=True, maxDifference=0.05 )
 
+	def testManyChannels( self ) :
+
+		# Writes are performed asynchronously while subsequent
+		# tiles are computed, so check that files with many
+		# channels and rows round-trip exactly in both modes.
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 300, 500 ) )
+		checker["size"].setValue( imath.V2f( 13 ) )
+
+		shuffle = GafferImage.Shuffle()
+		shuffle["in"].setInput( checker["out"] )
+		for layer in range( 0, 10 ) :
+			for channel in "RGBA" :
+				shuffle["channels"].addChild( shuffle.ChannelPlug( "layer{0}.{1}".format( layer, channel ), channel ) )
+
+		for mode in ( GafferImage.ImageWriter.Mode.Scanline, GafferImage.ImageWriter.Mode.Tile ) :
+
+			writer = GafferImage.ImageWriter()
+			writer["in"].setInput( shuffle["out"] )
+			writer["openexr"]["mode"].setValue( mode )
+			writer["openexr"]["compression"].setValue( "zip" )
+			writer["openexr"]["dataType"].setValue( "float" )
+			writer["fileName"].setValue( "{0}/manyChannels{1}.exr".format( self.temporaryDirectory(), mode ) )
+			writer["task"].execute()
+
+			reader = GafferImage.ImageReader()
+			reader["fileName"].setInput( writer["fileName"] )
+			self.assertEqual( len( reader["out"]["channelNames"].getValue() ), 44 )
+			self.assertImagesEqual( reader["out"], shuffle["out"], ignoreMetadata = True )
+
+	def testFrameConcurrency( self ) :
+
+		script = Gaffer.ScriptNode()
+
+		script["constant"] = GafferImage.Constant()
+		script["expression"] = Gaffer.Expression()
+		script["expression"].setExpression( 'parent["constant"]["color"]["r"] = context.getFrame()' )
+
+		script["writer"] = GafferImage.ImageWriter()
+		script["writer"]["in"].setInput( script["constant"]["out"] )
+		script["writer"]["fileName"].setValue( self.temporaryDirectory() + "/frameConcurrency.####.exr" )
+		script["writer"]["dispatcher"]["frameConcurrency"].setValue( 4 )
+
+		with script.context() :
+			script["writer"]["task"].executeSequence( range( 1, 9 ) )
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( script["writer"]["fileName"].getValue() )
+		for frame in range( 1, 9 ) :
+			with Gaffer.Context() as c :
+				c.setFrame( frame )
+				self.assertEqual( reader["out"].channelData( "R", imath.V2i( 0 ) )[0], frame )
+
+	def testFrameConcurrencyWithConstantFileName( self ) :
+
+		script = Gaffer.ScriptNode()
+
+		script["constant"] = GafferImage.Constant()
+		script["expression"] = Gaffer.Expression()
+		script["expression"].setExpression( 'parent["constant"]["color"]["r"] = context.getFrame()' )
+
+		script["writer"] = GafferImage.ImageWriter()
+		script["writer"]["in"].setInput( script["constant"]["out"] )
+		script["writer"]["dispatcher"]["frameConcurrency"].setValue( 4 )
+
+		for fileName in ( "frameConcurrency.####.exr", "frameConcurrency.${frame}.exr" ) :
+			script["writer"]["fileName"].setValue( self.temporaryDirectory() + "/" + fileName )
+			with script.context() :
+				self.assertTrue( script["writer"].canExecuteFramesConcurrently() )
+
+		# With a constant file name, every frame writes to the same file,
+		# so the frames must be executed serially, in order.
+
+		script["writer"]["fileName"].setValue( self.temporaryDirectory() + "/constantFileName.exr" )
+		with script.context() :
+			self.assertFalse( script["writer"].canExecuteFramesConcurrently() )
+			script["writer"]["task"].executeSequence( range( 1, 9 ) )
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( script["writer"]["fileName"].getValue() )
+		self.assertEqual( reader["out"].channelData( "R", imath.V2i( 0 ) )[0], 8 )
+
+	def testManyChannelsPerformance( self ) :
+
+		# This test can be useful when benchmarking the writing
+		# of multi-layer EXRs. It times computation of the image
+		# alone, writing alone (from a warm cache) and computation
+		# and writing together (from a cold cache). Writing is
+		# overlapped with computation, so the combined time should
+		# approach the larger of the other two rather than their
+		# sum. Uncomment the print statement to get timing information.
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 1024, 778 ) )
+
+		blur = GafferImage.Blur()
+		blur["in"].setInput( checker["out"] )
+		blur["radius"].setValue( imath.V2f( 4 ) )
+
+		shuffle = GafferImage.Shuffle()
+		shuffle["in"].setInput( blur["out"] )
+		for layer in range( 0, 20 ) :
+			for channel in "RGBA" :
+				shuffle["channels"].addChild( shuffle.ChannelPlug( "layer{0}.{1}".format( layer, channel ), channel ) )
+
+		for mode in ( GafferImage.ImageWriter.Mode.Scanline, GafferImage.ImageWriter.Mode.Tile ) :
+
+			writer = GafferImage.ImageWriter()
+			writer["in"].setInput( shuffle["out"] )
+			writer["openexr"]["mode"].setValue( mode )
+			writer["openexr"]["compression"].setValue( "zip" )
+			writer["fileName"].setValue( "{0}/manyChannelsPerformance{1}.exr".format( self.temporaryDirectory(), mode ) )
+
+			Gaffer.ValuePlug.clearCache()
+			t = IECore.Timer()
+			shuffle["out"].image()
+			computeTime = t.stop()
+
+			t = IECore.Timer()
+			writer["task"].execute()
+			writeTime = t.stop()
+
+			Gaffer.ValuePlug.clearCache()
+			t = IECore.Timer()
+			writer["task"].execute()
+			combinedTime = t.stop()
+
+			# print mode, "compute :", computeTime, "write :", writeTime, "combined :", combinedTime
+
+			reader = GafferImage.ImageReader()
+			reader["fileName"].setInput( writer["fileName"] )
+			self.assertEqual( len( reader["out"]["channelNames"].getValue() ), 84 )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -143,6 +143,27 @@ class MedianTest( GafferImageTest.ImageTestCase ) :
 			# a master
 			self.assertImagesEqual( masterMedianSingleChannel["out"], defaultMedianSingleChannel["out"] )
 
+	def testResolutionLevel( self ) :
+
+		c = GafferImage.Constant()
+		c["format"].setValue( GafferImage.Format( 100, 100 ) )
+
+		m = GafferImage.Median()
+		m["in"].setInput( c["out"] )
+		m["radius"].setValue( imath.V2i( 4 ) )
+		m["expandDataWindow"].setValue( True )
+
+		with Gaffer.Context() as context :
+
+			context["image:resolutionLevel"] = 1
+			self.assertEqual( c["out"]["dataWindow"].getValue(), imath.Box2i( imath.V2i( 0 ), imath.V2i( 50 ) ) )
+			# The radius is halved along with the image.
+			self.assertEqual( m["out"]["dataWindow"].getValue(), imath.Box2i( imath.V2i( -2 ), imath.V2i( 52 ) ) )
+
+			# Radii are rounded up, so they never vanish entirely.
+			m["radius"].setValue( imath.V2i( 1 ) )
+			self.assertEqual( m["out"]["dataWindow"].getValue(), imath.Box2i( imath.V2i( -1 ), imath.V2i( 51 ) ) )
+
 	def testCancellation( self ) :
 
 		c = GafferImage.Constant()
@@ -467,5 +467,40 @@ class MergeTest( GafferImageTest.ImageTestCase ) :
 		merge["in"][1].setInput( o["out"] )
 		merge["out"].image()
 
+	def testConstantInputs( self ) :
+
+		a = GafferImage.Constant()
+		a["format"].setValue( GafferImage.Format( 200, 200 ) )
+		a["color"].setValue( imath.Color4f( 0.25, 0.5, 0.75, 0.5 ) )
+
+		b = GafferImage.Constant()
+		b["format"].setValue( GafferImage.Format( 200, 200 ) )
+		b["color"].setValue( imath.Color4f( 1, 0.5, 0.25, 1 ) )
+
+		merge = GafferImage.Merge()
+		merge["in"][0].setInput( b["out"] )
+		merge["in"][1].setInput( a["out"] )
+		merge["operation"].setValue( GafferImage.Merge.Operation.Over )
+
+		sampler = GafferImage.ImageSampler()
+		sampler["image"].setInput( merge["out"] )
+		sampler["pixel"].setValue( imath.V2f( 150.5 ) )
+		self.assertEqual( sampler["color"].getValue(), imath.Color4f( 0.75, 0.75, 0.875, 1 ) )
+
+		tile = merge["out"].channelData( "R", imath.V2i( 0 ), _copy = False )
+		self.assertTrue( tile.isSame( merge["out"].channelData( "R", imath.V2i( GafferImage.ImagePlug.tileSize() ), _copy = False ) ) )
+
+		# Constant tiles must be composited the same as tiles which
+		# aren't, so offsetting one input must give the same result
+		# in the area where they still overlap.
+
+		offset = GafferImage.Offset()
+		offset["in"].setInput( a["out"] )
+		offset["offset"].setValue( imath.V2i( 10 ) )
+		merge["in"][1].setInput( offset["out"] )
+
+		self.assertEqual( sampler["color"].getValue(), imath.Color4f( 0.75, 0.75, 0.875, 1 ) )
+
+
 if __name__ == "__main__":
 	unittest.main()
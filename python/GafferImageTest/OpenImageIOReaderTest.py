@@ -40,6 +40,7 @@ import shutil
 import unittest
 import imath
 import random
+import itertools
 
 import IECore
 import IECoreImage
@@ -116,6 +117,50 @@ class OpenImageIOReaderTest( GafferImageTest.ImageTestCase ) :
 		image2.blindData().clear()
 		self.assertEqual( image, image2 )
 
+	def testHalfFloatRead( self ) :
+
+		n = GafferImage.OpenImageIOReader()
+		n["fileName"].setValue( self.alignmentTestSourceFileName )
+		self.assertEqual( n["out"]["metadata"].getValue()["dataType"].value, "half" )
+
+		# Half data is stored compactly in the cache, but
+		# must be identical to reading as float directly.
+
+		image = n["out"].image()
+		image2 = IECore.Reader.create( self.alignmentTestSourceFileName ).read()
+		image.blindData().clear()
+		image2.blindData().clear()
+		self.assertEqual( image, image2 )
+
+	def testCacheCompression( self ) :
+
+		compression = GafferImage.OpenImageIOReader.getCacheCompression()
+		self.addCleanup( GafferImage.OpenImageIOReader.setCacheCompression, compression )
+
+		n = GafferImage.OpenImageIOReader()
+		for fileName in [
+			self.fileName,
+			self.offsetDataWindowFileName,
+			self.circlesExrFileName,
+			self.circlesJpgFileName,
+			self.alignmentTestSourceFileName,
+		] :
+
+			n["fileName"].setValue( fileName )
+
+			GafferImage.OpenImageIOReader.setCacheCompression( False )
+			n["refreshCount"].setValue( n["refreshCount"].getValue() + 1 )
+			uncompressed = n["out"].image()
+
+			# Compressed tiles must decompress to exactly the same data.
+
+			GafferImage.OpenImageIOReader.setCacheCompression( True )
+			self.assertTrue( GafferImage.OpenImageIOReader.getCacheCompression() )
+			n["refreshCount"].setValue( n["refreshCount"].getValue() + 1 )
+			compressed = n["out"].image()
+
+			self.assertEqual( compressed, uncompressed )
+
 	def testNegativeDisplayWindowRead( self ) :
 
 		n = GafferImage.OpenImageIOReader()
@@ -278,6 +323,48 @@ class OpenImageIOReaderTest( GafferImageTest.ImageTestCase ) :
 		reader["fileName"].setValue( testSequence.fileNameForFrame( 1 )  )
 		self.assertEqual( reader["availableFrames"].getValue(), IECore.IntVectorData( [] ) )
 
+	def testPrefetch( self ) :
+
+		testSequence = IECore.FileSequence( self.temporaryDirectory() + "/incompleteSequence.####.exr" )
+		shutil.copyfile( self.fileName, testSequence.fileNameForFrame( 1 ) )
+		shutil.copyfile( self.offsetDataWindowFileName, testSequence.fileNameForFrame( 3 ) )
+
+		script = Gaffer.ScriptNode()
+		script["reader"] = GafferImage.OpenImageIOReader()
+		script["reader"]["fileName"].setValue( testSequence.fileName )
+
+		# Missing frames are ignored.
+		with script.context() :
+			task = script["reader"].prefetch( [ 1, 2, 3 ] )
+		task.wait()
+		self.assertEqual( task.status(), Gaffer.BackgroundTask.Status.Completed )
+
+		# Prefetched data should be in the cache, so reading
+		# it should not require any more reads from file.
+		context = Gaffer.Context( script.context() )
+		for frame in ( 1, 3 ) :
+			context.setFrame( frame )
+			with context, Gaffer.PerformanceMonitor() as monitor :
+				script["reader"]["out"].image()
+			self.assertEqual( monitor.plugStatistics( script["reader"]["__tileBatch"] ).computeCount, 0 )
+
+		# Prefetching is cancelled by edits.
+		with script.context() :
+			task = script["reader"].prefetch( range( 0, 1000 ) )
+		script["reader"]["refreshCount"].setValue( 1 )
+		self.assertIn( task.status(), ( Gaffer.BackgroundTask.Status.Cancelled, Gaffer.BackgroundTask.Status.Completed ) )
+
+	def testPrefetchConcurrency( self ) :
+
+		concurrency = GafferImage.OpenImageIOReader.getPrefetchConcurrency()
+		self.addCleanup( GafferImage.OpenImageIOReader.setPrefetchConcurrency, concurrency )
+
+		GafferImage.OpenImageIOReader.setPrefetchConcurrency( 2 )
+		self.assertEqual( GafferImage.OpenImageIOReader.getPrefetchConcurrency(), 2 )
+
+		GafferImage.OpenImageIOReader.setPrefetchConcurrency( 0 )
+		self.assertEqual( GafferImage.OpenImageIOReader.getPrefetchConcurrency(), 1 )
+
 	def testMissingFrameMode( self ) :
 
 		testSequence = IECore.FileSequence( self.temporaryDirectory() + "/incompleteSequence.####.exr" )
@@ -595,6 +682,145 @@ class OpenImageIOReaderTest( GafferImageTest.ImageTestCase ) :
 		self.assertEqual( len( mh.messages ), 1 )
 		self.assertTrue( mh.messages[0].message.startswith( "Ignoring subimage 1 of " ) )
 
+	def testResolutionLevel( self ) :
+
+		constant = GafferImage.Constant()
+		constant["format"].setValue( GafferImage.Format( 64, 64 ) )
+		constant["color"].setValue( imath.Color4f( 0.25, 0.5, 1, 1 ) )
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( constant["out"] )
+		writer["fileName"].setValue( os.path.join( self.temporaryDirectory(), "constant.exr" ) )
+		writer["task"].execute()
+
+		reader = GafferImage.OpenImageIOReader()
+		reader["fileName"].setInput( writer["fileName"] )
+
+		with Gaffer.Context() as context :
+
+			fullHash = reader["out"].channelDataHash( "R", imath.V2i( 0 ) )
+
+			context["image:resolutionLevel"] = 2
+			self.assertEqual( reader["out"]["format"].getValue(), GafferImage.Format( 16, 16 ) )
+			self.assertEqual( reader["out"]["dataWindow"].getValue(), imath.Box2i( imath.V2i( 0 ), imath.V2i( 16 ) ) )
+			self.assertNotEqual( reader["out"].channelDataHash( "R", imath.V2i( 0 ) ), fullHash )
+
+			sampler = GafferImage.Sampler( reader["out"], "G", imath.Box2i( imath.V2i( 0 ), imath.V2i( 16 ) ) )
+			for y in range( 0, 16 ) :
+				for x in range( 0, 16 ) :
+					self.assertEqual( sampler.sample( x, y ), 0.5 )
+
+	def testMultiLayerRead( self ) :
+
+		checkerboard = GafferImage.Checkerboard()
+		checkerboard["format"].setValue( GafferImage.Format( 200, 150 ) )
+		checkerboard["size"].setValue( imath.V2f( 13 ) )
+		checkerboard["colorA"].setValue( imath.Color4f( 0.1, 0.2, 0.3, 1 ) )
+		checkerboard["colorB"].setValue( imath.Color4f( 0.4, 0.5, 0.6, 0.5 ) )
+
+		shuffle = GafferImage.Shuffle()
+		shuffle["in"].setInput( checkerboard["out"] )
+		for layer, channels in [
+			( "diffuse", [ ( "R", "G" ), ( "G", "B" ), ( "B", "R" ) ] ),
+			( "specular", [ ( "R", "B" ), ( "G", "A" ), ( "B", "G" ) ] ),
+			( "depth", [ ( "Z", "A" ) ] ),
+		] :
+			for out, source in channels :
+				shuffle["channels"].addChild( shuffle.ChannelPlug( layer + "." + out, source ) )
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( shuffle["out"] )
+		writer["openexr"]["dataType"].setValue( "float" )
+
+		reader = GafferImage.OpenImageIOReader()
+		reader["fileName"].setInput( writer["fileName"] )
+
+		for mode in [ GafferImage.ImageWriter.Mode.Scanline, GafferImage.ImageWriter.Mode.Tile ] :
+
+			writer["fileName"].setValue( os.path.join( self.temporaryDirectory(), "multiLayer{}.exr".format( mode ) ) )
+			writer["openexr"]["mode"].setValue( mode )
+			writer["task"].execute()
+
+			# Each layer is read separately, so reading one layer
+			# must not disturb the others.
+			self.assertEqual(
+				reader["out"].channelData( "specular.G", imath.V2i( 0 ) ),
+				shuffle["out"].channelData( "specular.G", imath.V2i( 0 ) )
+			)
+			self.assertImagesEqual( reader["out"], shuffle["out"], ignoreMetadata = True )
+
+			# Channels are grouped into runs sharing a layer, and each
+			# tile batch must hold only the channels of its own group.
+
+			groups = [
+				list( g ) for k, g in itertools.groupby(
+					reader["out"]["channelNames"].getValue(), GafferImage.ImageAlgo.layerName
+				)
+			]
+			self.assertEqual( len( groups ), 4 )
+
+			batchSizes = []
+			with Gaffer.Context() as context :
+				for i, group in enumerate( groups ) :
+					context["__tileBatchIndex"] = imath.V3i( 0, 0, i )
+					batch = reader["__tileBatch"].getValue()
+					self.assertEqual( len( batch ) % len( group ), 0 )
+					batchSizes.append( len( batch ) // len( group ) )
+
+			# Every group covers the same tiles, so the batches differ
+			# only by their number of channels.
+			self.assertEqual( len( set( batchSizes ) ), 1 )
+
+	def testMultiLayerScanlinePerformance( self ) :
+
+		# This test can be useful when benchmarking the reading of
+		# multi-layer scanline EXRs. It times reading a single layer
+		# and reading every layer, each from a cold cache. Because tile
+		# batches only hold a single layer, reading one layer should take
+		# a fraction of the time of reading all of them. Uncomment the
+		# print statement to get timing information.
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 1024, 778 ) )
+
+		shuffle = GafferImage.Shuffle()
+		shuffle["in"].setInput( checker["out"] )
+		for layer in range( 0, 20 ) :
+			for channel in "RGBA" :
+				shuffle["channels"].addChild( shuffle.ChannelPlug( "layer{0}.{1}".format( layer, channel ), channel ) )
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( shuffle["out"] )
+		writer["openexr"]["mode"].setValue( GafferImage.ImageWriter.Mode.Scanline )
+		writer["openexr"]["compression"].setValue( "zip" )
+		writer["fileName"].setValue( os.path.join( self.temporaryDirectory(), "multiLayerScanline.exr" ) )
+		writer["task"].execute()
+
+		reader = GafferImage.OpenImageIOReader()
+		reader["fileName"].setInput( writer["fileName"] )
+
+		deleteChannels = GafferImage.DeleteChannels()
+		deleteChannels["in"].setInput( reader["out"] )
+		deleteChannels["mode"].setValue( GafferImage.DeleteChannels.Mode.Keep )
+		deleteChannels["channels"].setValue( "layer7.*" )
+
+		Gaffer.ValuePlug.clearCache()
+		t = IECore.Timer()
+		GafferImageTest.processTiles( deleteChannels["out"] )
+		layerTime = t.stop()
+
+		Gaffer.ValuePlug.clearCache()
+		t = IECore.Timer()
+		GafferImageTest.processTiles( reader["out"] )
+		allLayersTime = t.stop()
+
+		# print "one layer :", layerTime, "all layers :", allLayersTime
+
+		self.assertEqual( len( deleteChannels["out"]["channelNames"].getValue() ), 4 )
+		self.assertEqual(
+			deleteChannels["out"].channelData( "layer7.G", imath.V2i( 0 ) ),
+			shuffle["out"].channelData( "layer7.G", imath.V2i( 0 ) )
+		)
 
 if __name__ == "__main__":
 	unittest.main()
@@ -76,5 +76,25 @@ class RectangleTest( GafferImageTest.ImageTestCase ) :
 				else :
 					self.assertEqual( v, 0 )
 
+	def testResolutionLevel( self ) :
+
+		r = GafferImage.Rectangle()
+		r["area"].setValue( imath.Box2f( imath.V2f( 10 ), imath.V2f( 100 ) ) )
+		r["lineWidth"].setValue( 10 )
+
+		fullHash = r["out"].channelDataHash( "A", imath.V2i( 0 ) )
+
+		with Gaffer.Context() as context :
+
+			context["image:resolutionLevel"] = 1
+
+			# The area and line width are both halved, and the
+			# data window is rounded outwards to whole pixels.
+			dw = r["out"]["dataWindow"].getValue()
+			self.assertEqual( dw.min(), imath.V2i( 2 ) )
+			self.assertEqual( dw.max(), imath.V2i( 53 ) )
+
+			self.assertNotEqual( r["out"].channelDataHash( "A", imath.V2i( 0 ) ), fullHash )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -242,5 +242,27 @@ class ResizeTest( GafferImageTest.ImageTestCase ) :
 
 		self.assertEqual( r["out"]["dataWindow"].getValue(), imath.Box2i() )
 
+	def testResolutionLevel( self ) :
+
+		c = GafferImage.Constant()
+		c["format"].setValue( GafferImage.Format( 100, 100 ) )
+
+		r = GafferImage.Resize()
+		r["in"].setInput( c["out"] )
+		r["format"].setValue( GafferImage.Format( 200, 200 ) )
+
+		with Gaffer.Context() as context :
+
+			context["image:resolutionLevel"] = 1
+			self.assertEqual( r["in"]["format"].getValue(), GafferImage.Format( 50, 50 ) )
+			self.assertEqual( r["out"]["format"].getValue(), GafferImage.Format( 100, 100 ) )
+			self.assertEqual( r["out"]["dataWindow"].getValue(), imath.Box2i( imath.V2i( 0 ), imath.V2i( 100 ) ) )
+
+			# Disabled, the input passes through without
+			# being reduced a second time.
+			r["enabled"].setValue( False )
+			self.assertEqual( r["out"]["format"].getValue(), GafferImage.Format( 50, 50 ) )
+			self.assertEqual( r["out"]["dataWindow"].getValue(), imath.Box2i( imath.V2i( 0 ), imath.V2i( 50 ) ) )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -203,5 +203,30 @@ class SamplerTest( GafferImageTest.ImageTestCase ) :
 		sampler = GafferImage.Sampler( empty["out"], "R", empty["out"]["format"].getValue().getDisplayWindow(), boundingMode = GafferImage.Sampler.BoundingMode.Clamp )
 		self.assertEqual( sampler.sample( 0, 0 ), 0.0 )
 
+	def testSampleRegion( self ) :
+
+		r = GafferImage.ImageReader()
+		r["fileName"].setValue( self.fileName )
+
+		dw = r["out"]["dataWindow"].getValue()
+		for region in [
+			dw,
+			imath.Box2i( dw.min() - imath.V2i( 70 ), dw.min() + imath.V2i( 10 ) ),
+			imath.Box2i( dw.max() - imath.V2i( 10, 100 ), dw.max() + imath.V2i( 5, 30 ) ),
+			imath.Box2i( dw.max() + imath.V2i( 3 ), dw.max() + imath.V2i( 20 ) ),
+		] :
+			for boundingMode in GafferImage.Sampler.BoundingMode.values.values() :
+
+				sampler = GafferImage.Sampler( r["out"], "R", region, boundingMode )
+				samples = sampler.sampleRegion( region )
+				self.assertEqual( len( samples ), region.size().x * region.size().y )
+
+				i = 0
+				for y in range( region.min().y, region.max().y ) :
+					for x in range( region.min().x, region.max().x ) :
+						self.assertEqual( samples[i], sampler.sample( x, y ) )
+						i += 1
+
+
 if __name__ == "__main__":
 	unittest.main()
@@ -34,6 +34,7 @@
 #
 ##########################################################################
 
+import os
 import functools
 import imath
 
@@ -565,10 +566,11 @@ class _ImageListing( GafferUI.PlugValueWidget ) :
 
 		with self.getContext() :
 			fileName = self.__catalogue().generateFileName( image )
-			imageWriter = GafferImage.ImageWriter()
-			imageWriter["in"].setInput( image )
-			imageWriter["fileName"].setValue( fileName )
-			imageWriter["task"].execute()
+			if not os.path.exists( fileName ) :
+				imageWriter = GafferImage.ImageWriter()
+				imageWriter["in"].setInput( image )
+				imageWriter["fileName"].setValue( fileName )
+				imageWriter["task"].execute()
 
 		with Gaffer.UndoScope( self.getPlug().ancestor( Gaffer.ScriptNode ) ) :
 			loadedImage = GafferImage.Catalogue.Image.load( fileName )
@@ -58,7 +58,8 @@ Gaffer.Metadata.registerNode(
 	"description",
 	"""
 	Calculates minimum, maximum and average colours for a region of
-	an image. These outputs can then be used to drive other plugs
+	an image, along with a histogram and a percentile value for each
+	channel. These outputs can then be used to drive other plugs
 	within the node graph.
 	""",
 
@@ -96,6 +97,41 @@ Gaffer.Metadata.registerNode(
 
 		],
 
+		"histogramBins" : [
+
+			"description",
+			"""
+			The number of bins used for the histogram.
+			""",
+
+			"nodule:type", "",
+
+		],
+
+		"histogramRange" : [
+
+			"description",
+			"""
+			The range of values covered by the histogram. Values
+			outside the range are counted in the first or last bin.
+			""",
+
+			"nodule:type", "",
+
+		],
+
+		"percentile" : [
+
+			"description",
+			"""
+			The percentile to be output on the percentileValue plug,
+			in the range 0-100. The default of 50 gives the median.
+			""",
+
+			"nodule:type", "",
+
+		],
+
 		"average" : [
 
 			"description",
@@ -123,6 +159,31 @@ Gaffer.Metadata.registerNode(
 
 		],
 
+		"histogram" : [
+
+			"description",
+			"""
+			The per-channel histograms computed from the input image region,
+			each containing `histogramBins` sample counts.
+			""",
+
+			"plugValueWidget:type", "",
+			"nodule:type", "",
+
+		],
+
+		"percentileValue" : [
+
+			"description",
+			"""
+			The per-channel values below which `percentile` percent of the
+			samples in the input image region fall. These are estimated by
+			interpolating within the histogram, so are only accurate for
+			values within `histogramRange`.
+			""",
+
+		],
+
 	}
 
 )
@@ -473,6 +473,7 @@ class _StateWidget( GafferUI.Widget ) :
 			self.__button = GafferUI.Button( hasFrame = False )
 
 		self.__imageGadget = imageView.viewportGadget().getPrimaryChild()
+		self.__prefetcher = _PlaybackPrefetcher( imageView )
 
 		self.__buttonClickedConnection = self.__button.clickedSignal().connect(
 			Gaffer.WeakMethod( self.__buttonClick )
@@ -498,3 +499,128 @@ class _StateWidget( GafferUI.Widget ) :
 		paused = self.__imageGadget.getPaused()
 		self.__button.setImage( "timelinePause.png" if not paused else "timelinePlay.png" )
 		self.__busyWidget.setBusy( self.__imageGadget.state() == self.__imageGadget.State.Running )
+
+##########################################################################
+# _PlaybackPrefetcher
+##########################################################################
+
+## Prefetches upcoming frames from the ImageReaders upstream of
+# an ImageView during playback, so that file reads are overlapped
+# with the display of the current frame.
+class _PlaybackPrefetcher( object ) :
+
+	## The number of frames to read ahead of the current frame.
+	frames = 8
+
+	def __init__( self, imageView ) :
+
+		self.__imageView = imageView
+		self.__tasks = []
+		self.__prefetchedFrames = set()
+
+		self.__viewContextChangedConnection = imageView.contextChangedSignal().connect(
+			Gaffer.WeakMethod( self.__viewContextChanged )
+		)
+		self.__viewContextChanged( imageView )
+
+	def __viewContextChanged( self, imageView ) :
+
+		self.__cancel()
+
+		self.__playback = GafferUI.Playback.acquire( imageView.getContext() )
+		self.__playbackStateChangedConnection = self.__playback.stateChangedSignal().connect(
+			Gaffer.WeakMethod( self.__playbackStateChanged )
+		)
+		self.__contextChangedConnection = imageView.getContext().changedSignal().connect(
+			Gaffer.WeakMethod( self.__contextChanged )
+		)
+
+	def __playbackStateChanged( self, playback ) :
+
+		self.__cancel()
+		self.__prefetch()
+
+	def __contextChanged( self, context, name ) :
+
+		if name == "frame" :
+			self.__prefetch()
+
+	def __prefetch( self ) :
+
+		state = self.__playback.getState()
+		if state == GafferUI.Playback.State.PlayingForwards :
+			increment = 1
+		elif state == GafferUI.Playback.State.PlayingBackwards :
+			increment = -1
+		else :
+			return
+
+		# Find the upcoming frames, wrapping in the same way
+		# as the Playback class. We only prefetch frames we
+		# haven't already prefetched during this playback.
+
+		context = self.__playback.context()
+		frameRange = self.__playback.getFrameRange()
+
+		frames = []
+		frame = context.getFrame()
+		for i in range( 0, self.frames ) :
+			frame += increment
+			if frame > frameRange[1] :
+				frame = frameRange[0] + ( frame - math.floor( frame ) )
+			elif frame < frameRange[0] :
+				frame = frameRange[1] + ( frame - math.floor( frame ) )
+			if frame not in self.__prefetchedFrames :
+				frames.append( frame )
+
+		if not frames :
+			return
+
+		self.__prefetchedFrames.update( frames )
+		self.__tasks = [
+			t for t in self.__tasks
+			if t.status() in ( Gaffer.BackgroundTask.Status.Pending, Gaffer.BackgroundTask.Status.Running )
+		]
+
+		with context :
+			for reader in self.__readers() :
+				self.__tasks.append( reader.prefetch( frames ) )
+
+	def __cancel( self ) :
+
+		for task in self.__tasks :
+			task.cancel()
+
+		self.__tasks = []
+		self.__prefetchedFrames = set()
+
+	def __readers( self ) :
+
+		result = []
+
+		input = self.__imageView["in"].getInput()
+		if input is None :
+			return result
+
+		visited = []
+		toVisit = [ input.node() ]
+		while toVisit :
+
+			node = toVisit.pop()
+			if node is None or any( node.isSame( v ) for v in visited ) :
+				continue
+			visited.append( node )
+
+			if isinstance( node, ( GafferImage.ImageReader, GafferImage.OpenImageIOReader ) ) :
+				result.append( node )
+				continue
+
+			plugs = list( node.children( Gaffer.Plug ) )
+			while plugs :
+				plug = plugs.pop()
+				plugInput = plug.getInput()
+				if plugInput is not None :
+					toVisit.append( plugInput.node() )
+				plugs.extend( plug.children( Gaffer.Plug ) )
+
+		return result
@@ -35,6 +35,7 @@
 ##########################################################################
 
 import unittest
+import time
 import imath
 
 import Gaffer
@@ -100,6 +101,28 @@ class ImageGadgetTest( GafferUITest.TestCase ) :
 		del g, w
 		del s
 
+	def testComputesAllTiles( self ) :
+
+		# Tiles are computed in priority order, starting with the ones
+		# that are visible, but all tiles should be computed eventually.
+
+		c = GafferImage.Constant()
+		c["format"].setValue( GafferImage.Format( 3000, 2000 ) )
+
+		g = GafferImageUI.ImageGadget()
+		g.setImage( c["out"] )
+
+		with GafferUI.Window() as w :
+			GafferUI.GadgetWidget( g )
+
+		w.setVisible( True )
+
+		t = time.time()
+		while g.state() != g.State.Complete and time.time() - t < 10 :
+			self.waitForIdle( 100 )
+
+		self.assertEqual( g.state(), g.State.Complete )
+
 if __name__ == "__main__":
 	unittest.main()
 
@@ -85,5 +85,32 @@ class ImageViewTest( GafferUITest.TestCase ) :
 		view["exposure"].setValue( 1 )
 		view["gamma"].setValue( 0.5 )
 
+	def testPlaybackPrefetch( self ) :
+
+		script = Gaffer.ScriptNode()
+		script["box"] = Gaffer.Box()
+		script["box"]["reader"] = GafferImage.ImageReader()
+		script["box"]["reader"]["fileName"].setValue( "${GAFFER_ROOT}/python/GafferImageTest/images/checker.exr" )
+		Gaffer.PlugAlgo.promote( script["box"]["reader"]["out"] )
+		script["grade"] = GafferImage.Grade()
+		script["grade"]["in"].setInput( script["box"]["out"] )
+
+		view = GafferUI.View.create( script["grade"]["out"] )
+		view.setContext( script.context() )
+
+		prefetcher = GafferImageUI.ImageViewUI._PlaybackPrefetcher( view )
+		self.assertEqual( len( prefetcher._PlaybackPrefetcher__tasks ), 0 )
+
+		playback = GafferUI.Playback.acquire( script.context() )
+		playback.setState( playback.State.PlayingForwards )
+		self.assertEqual( len( prefetcher._PlaybackPrefetcher__tasks ), 1 )
+		self.assertEqual(
+			prefetcher._PlaybackPrefetcher__prefetchedFrames,
+			set( range( 2, 2 + prefetcher.frames ) )
+		)
+
+		playback.setState( playback.State.Stopped )
+		self.assertEqual( len( prefetcher._PlaybackPrefetcher__tasks ), 0 )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -0,0 +1,153 @@
+##########################################################################
+#
+#  Copyright (c) 2026, Image Engine Design Inc. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+import unittest
+
+import IECore
+
+import Gaffer
+import GafferScene
+import GafferSceneTest
+
+class CameraVisibilityProcessorTest( GafferSceneTest.SceneTestCase ) :
+
+	# Node types, and the distance in front of the camera
+	# at which each hides part of the level of detail group.
+	__nodeTypes = [
+		( GafferScene.LevelOfDetail, 200 ),
+		( GafferScene.FrustumCull, -200 ),
+	]
+
+	def __scene( self, nodeType, distance ) :
+
+		script = Gaffer.ScriptNode()
+
+		script["sphere"] = GafferScene.Sphere()
+
+		script["lod"] = GafferScene.Group()
+		script["lod"]["name"].setValue( "lod" )
+		script["lod"]["transform"]["translate"]["z"].setValue( -distance )
+		for i in range( 0, 3 ) :
+			script["lod"]["in"][i].setInput( script["sphere"]["out"] )
+
+		script["camera"] = GafferScene.Camera()
+
+		script["group"] = GafferScene.Group()
+		script["group"]["in"][0].setInput( script["lod"]["out"] )
+		script["group"]["in"][1].setInput( script["camera"]["out"] )
+
+		script["options"] = GafferScene.StandardOptions()
+		script["options"]["in"].setInput( script["group"]["out"] )
+		script["options"]["options"]["renderCamera"]["enabled"].setValue( True )
+		script["options"]["options"]["renderCamera"]["value"].setValue( "/group/camera" )
+
+		script["filter"] = GafferScene.PathFilter()
+		script["filter"]["paths"].setValue( IECore.StringVectorData( [ "/group/lod*" ] ) )
+
+		script["node"] = nodeType()
+		script["node"]["in"].setInput( script["options"]["out"] )
+		script["node"]["filter"].setInput( script["filter"]["out"] )
+
+		return script
+
+	def __hiddenPaths( self, scene, path = "/" ) :
+
+		result = []
+
+		attributes = scene.attributes( path )
+		if "scene:visible" in attributes and not attributes["scene:visible"].value :
+			result.append( path )
+
+		for name in scene.childNames( path ) :
+			result.extend( self.__hiddenPaths( scene, path.rstrip( "/" ) + "/" + str( name ) ) )
+
+		return result
+
+	def testNoCamera( self ) :
+
+		for nodeType, distance in self.__nodeTypes :
+
+			script = self.__scene( nodeType, distance )
+			node = script["node"]
+			self.assertNotEqual( self.__hiddenPaths( node["out"] ), [] )
+
+			script["options"]["options"]["renderCamera"]["value"].setValue( "/not/a/camera" )
+			self.assertEqual( self.__hiddenPaths( node["out"] ), [] )
+
+			script["options"]["options"]["renderCamera"]["enabled"].setValue( False )
+			self.assertEqual( self.__hiddenPaths( node["out"] ), [] )
+
+			node["camera"].setValue( "/group/camera" )
+			self.assertNotEqual( self.__hiddenPaths( node["out"] ), [] )
+
+			node["camera"].setValue( "/group/lod" )
+			self.assertEqual( self.__hiddenPaths( node["out"] ), [] )
+
+	def testCameraSampledOnce( self ) :
+
+		for nodeType, distance in self.__nodeTypes :
+
+			script = self.__scene( nodeType, distance )
+
+			script["duplicate"] = GafferScene.Duplicate()
+			script["duplicate"]["in"].setInput( script["group"]["out"] )
+			script["duplicate"]["target"].setValue( "/group/lod" )
+			script["duplicate"]["copies"].setValue( 20 )
+			script["options"]["in"].setInput( script["duplicate"]["out"] )
+
+			node = script["node"]
+			with Gaffer.ContextMonitor( node ) as monitor :
+				self.assertEqual( len( self.__hiddenPaths( node["out"] ) ), 21 * ( 2 if nodeType is GafferScene.LevelOfDetail else 1 ) )
+
+			statistics = monitor.plugStatistics( node["__cameraSamples"] )
+			self.assertEqual( statistics.numUniqueContexts(), 1 )
+			self.assertNotIn( "scene:path", statistics.variableNames() )
+
+	def testAffects( self ) :
+
+		for nodeType, distance in self.__nodeTypes :
+
+			node = nodeType()
+			for plug in [ node["camera"], node["in"]["globals"], node["in"]["transform"], node["in"]["object"] ] :
+				self.assertIn( node["__cameraSamples"], node.affects( plug ) )
+
+			for plug in [ node["__cameraSamples"], node["filter"], node["in"]["attributes"], node["in"]["transform"], node["in"]["bound"] ] :
+				self.assertIn( node["out"]["attributes"], node.affects( plug ) )
+
+			self.assertNotIn( node["out"]["attributes"], node.affects( node["camera"] ) )
+
+if __name__ == "__main__":
+	unittest.main()
@@ -84,5 +84,119 @@ class CapsuleTest( GafferSceneTest.SceneTestCase ) :
 		self.assertRaisesRegexp( RuntimeError, "Capsule has expired", capsuleCopy.hash )
 		self.assertRaisesRegexp( RuntimeError, "Capsule has expired", capsuleCopy.bound )
 
+	def testRenderAfterRenamingSet( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		pathFilter = GafferScene.PathFilter()
+		pathFilter["paths"].setValue( IECore.StringVectorData( [ "/sphere" ] ) )
+
+		# The Set node's set hash doesn't depend on the set name,
+		# so renaming it doesn't change the hash of the set itself.
+
+		setNode = GafferScene.Set()
+		setNode["in"].setInput( sphere["out"] )
+		setNode["filter"].setInput( pathFilter["out"] )
+		setNode["name"].setValue( "render:A" )
+
+		def renderedSets() :
+
+			capsule = GafferScene.Capsule(
+				setNode["out"],
+				"/",
+				Gaffer.Context(),
+				setNode["out"].objectHash( "/sphere" ),
+				setNode["out"].bound( "/" )
+			)
+
+			renderer = GafferScene.Private.IECoreScenePreview.Renderer.create(
+				"Capturing",
+				GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Interactive
+			)
+			capsule.render( renderer )
+
+			objects = renderer.command( "capturing:objects", {} )
+			return objects["/sphere"]["attributes"]["sets"]
+
+		self.assertEqual( renderedSets(), IECore.InternedStringVectorData( [ "A" ] ) )
+
+		setNode["name"].setValue( "render:B" )
+		self.assertEqual( renderedSets(), IECore.InternedStringVectorData( [ "B" ] ) )
+
+	def testRenderStateSharedBetweenPaths( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( sphere["out"] )
+		group["in"][1].setInput( sphere["out"] )
+
+		renderer = GafferScene.Private.IECoreScenePreview.Renderer.create(
+			"Capturing",
+			GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Interactive
+		)
+
+		# Capsules are computed in a context containing the path of
+		# their location, as for the Encapsulate node. The globals and
+		# sets must be evaluated without it, so that all capsules share
+		# a single render state.
+
+		with Gaffer.ContextMonitor() as monitor :
+			for name in ( "sphere", "sphere1" ) :
+				context = Gaffer.Context()
+				context["scene:path"] = IECore.InternedStringVectorData( [ "group", name ] )
+				capsule = GafferScene.Capsule(
+					group["out"],
+					"/group/" + name,
+					context,
+					group["out"].objectHash( "/group/" + name ),
+					group["out"].bound( "/group/" + name )
+				)
+				capsule.render( renderer )
+
+		# The Group passes the globals through from the Sphere.
+		for plug in ( sphere["out"]["globals"], group["out"]["setNames"] ) :
+			statistics = monitor.plugStatistics( plug )
+			self.assertEqual( statistics.numUniqueContexts(), 1 )
+			self.assertNotIn( "scene:path", statistics.variableNames() )
+
+		self.assertEqual( set( renderer.command( "capturing:objects", {} ).keys() ), { "/group/sphere", "/group/sphere1" } )
+
+	def testIdenticalCapsulesShared( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( sphere["out"] )
+
+		pathFilter = GafferScene.PathFilter()
+		pathFilter["paths"].setValue( IECore.StringVectorData( [ "/group" ] ) )
+
+		encapsulate = GafferScene.Encapsulate()
+		encapsulate["in"].setInput( group["out"] )
+		encapsulate["filter"].setInput( pathFilter["out"] )
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( encapsulate["out"] )
+		duplicate["target"].setValue( "/group" )
+		duplicate["copies"].setValue( 3 )
+
+		renderer = GafferScene.Private.IECoreScenePreview.Renderer.create(
+			"Capturing",
+			GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Interactive
+		)
+		controller = GafferScene.RenderController( duplicate["out"], Gaffer.Context(), renderer )
+		controller.update()
+
+		# Copies of a capsule have identical hashes, so the renderer
+		# is given a single capsule for all of them. Backends instance
+		# objects they are given repeatedly, so the capsule is only
+		# expanded once.
+
+		paths = [ "/group" ] + [ "/group%d" % i for i in range( 1, 4 ) ]
+		objects = renderer.command( "capturing:objects", {} )
+		self.assertEqual( set( objects.keys() ), set( paths ) )
+		self.assertEqual( len( set( objects[p]["objectId"].value for p in paths ) ), 1 )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -38,6 +38,7 @@ import unittest
 import imath
 
 import IECore
+import IECoreScene
 
 import Gaffer
 import GafferScene
@@ -102,6 +103,56 @@ class FreezeTransformTest( GafferSceneTest.SceneTestCase ) :
 		self.assertEqual( t["out"].bound( "/group/plane" ), imath.Box3f( imath.V3f( 1.5, 1.5, 3 ), imath.V3f( 2.5, 2.5, 3 ) ) )
 		self.assertEqual( t["out"].bound( "/group/plane1" ), imath.Box3f( imath.V3f( 0.5, -0.5, 0 ), imath.V3f( 1.5, 0.5, 0 ) ) )
 
+	def testPrimitiveVariableInterpretations( self ) :
+
+		# Enough points to be processed in parallel.
+		numPoints = 100000
+		positions = IECore.V3fVectorData( [ imath.V3f( i, 0, 0 ) for i in range( 0, numPoints ) ], IECore.GeometricData.Interpretation.Point )
+		points = IECoreScene.PointsPrimitive( positions )
+		points["N"] = IECoreScene.PrimitiveVariable(
+			IECoreScene.PrimitiveVariable.Interpolation.Vertex,
+			IECore.V3fVectorData( [ imath.V3f( 1, 1, 0 ) ] * numPoints, IECore.GeometricData.Interpretation.Normal )
+		)
+		points["v"] = IECoreScene.PrimitiveVariable(
+			IECoreScene.PrimitiveVariable.Interpolation.Vertex,
+			IECore.V3fVectorData( [ imath.V3f( 1, 1, 0 ) ] * numPoints, IECore.GeometricData.Interpretation.Vector )
+		)
+		points["c"] = IECoreScene.PrimitiveVariable(
+			IECoreScene.PrimitiveVariable.Interpolation.Vertex,
+			IECore.V3fVectorData( [ imath.V3f( 1, 1, 0 ) ] * numPoints )
+		)
+		# Shares data with "P", and must not be transformed twice.
+		points["Pref"] = points["P"]
+
+		objectToScene = GafferScene.ObjectToScene()
+		objectToScene["object"].setValue( points )
+		objectToScene["transform"]["translate"].setValue( imath.V3f( 1, 2, 3 ) )
+		objectToScene["transform"]["scale"].setValue( imath.V3f( 2, 1, 1 ) )
+
+		freezeTransform = GafferScene.FreezeTransform()
+		freezeTransform["in"].setInput( objectToScene["out"] )
+
+		matrix = objectToScene["out"].transform( "/object" )
+		normalMatrix = matrix.inverse().transposed()
+
+		frozen = freezeTransform["out"].object( "/object" )
+		for i in ( 0, 1, numPoints / 2, numPoints - 1 ) :
+			self.assertEqual( frozen["P"].data[i], positions[i] * matrix )
+			self.assertEqual( frozen["Pref"].data[i], positions[i] * matrix )
+			self.assertEqual( frozen["N"].data[i], normalMatrix.multDirMatrix( imath.V3f( 1, 1, 0 ) ) )
+			self.assertEqual( frozen["v"].data[i], matrix.multDirMatrix( imath.V3f( 1, 1, 0 ) ) )
+			self.assertEqual( frozen["c"].data[i], imath.V3f( 1, 1, 0 ) )
+
+		# Data which isn't transformed is shared with the input, rather
+		# than being copied.
+
+		inputObject = objectToScene["out"].object( "/object", _copy = False )
+		frozen = freezeTransform["out"].object( "/object", _copy = False )
+		self.assertTrue( frozen["c"].data.isSame( inputObject["c"].data ) )
+		for name in ( "P", "Pref", "N", "v" ) :
+			self.assertFalse( frozen[name].data.isSame( inputObject[name].data ) )
+		self.assertTrue( frozen["P"].data.isSame( frozen["Pref"].data ) )
+
 	def testAffects( self ) :
 
 		t = GafferScene.FreezeTransform()
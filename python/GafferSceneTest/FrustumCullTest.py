@@ -0,0 +1,197 @@
+##########################################################################
+#
+#  Copyright (c) 2026, Image Engine Design Inc. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+
+import unittest
+
+import imath
+
+import IECore
+
+import Gaffer
+import GafferScene
+import GafferSceneTest
+
+class FrustumCullTest( GafferSceneTest.SceneTestCase ) :
+
+	def __scene( self ) :
+
+		script = Gaffer.ScriptNode()
+
+		script["sphere"] = GafferScene.Sphere()
+		script["sphere"]["transform"]["translate"]["z"].setValue( -5 )
+
+		script["light"] = GafferSceneTest.TestLight()
+		script["light"]["transform"]["translate"]["z"].setValue( 10 )
+
+		script["camera"] = GafferScene.Camera()
+
+		script["group"] = GafferScene.Group()
+		script["group"]["in"][0].setInput( script["sphere"]["out"] )
+		script["group"]["in"][1].setInput( script["light"]["out"] )
+		script["group"]["in"][2].setInput( script["camera"]["out"] )
+
+		script["options"] = GafferScene.StandardOptions()
+		script["options"]["in"].setInput( script["group"]["out"] )
+		script["options"]["options"]["renderCamera"]["enabled"].setValue( True )
+		script["options"]["options"]["renderCamera"]["value"].setValue( "/group/camera" )
+
+		script["filter"] = GafferScene.PathFilter()
+		script["filter"]["paths"].setValue( IECore.StringVectorData( [ "/group/*" ] ) )
+
+		script["frustumCull"] = GafferScene.FrustumCull()
+		script["frustumCull"]["in"].setInput( script["options"]["out"] )
+		script["frustumCull"]["filter"].setInput( script["filter"]["out"] )
+		script["frustumCull"]["padding"].setValue( 0 )
+
+		return script
+
+	def __visible( self, scene, path ) :
+
+		attributes = scene.attributes( path )
+		return "scene:visible" not in attributes or attributes["scene:visible"].value
+
+	def test( self ) :
+
+		script = self.__scene()
+		frustumCull = script["frustumCull"]
+
+		for translate, culled in [
+			( ( 0, 0, -5 ), False ),
+			( ( 0, 0, 5 ), True ),
+			( ( 5, 0, -5 ), True ),
+			( ( 0, -4, -5 ), True ),
+			( ( 3, 0, -5 ), False ),
+			( ( 0, 0, -200000 ), True ),
+		] :
+			script["sphere"]["transform"]["translate"].setValue( imath.V3f( *translate ) )
+			self.assertEqual( frustumCull.culled( "/group/sphere" ), culled )
+			self.assertEqual( self.__visible( frustumCull["out"], "/group/sphere" ), not culled )
+			self.assertSceneValid( frustumCull["out"] )
+
+	def testPadding( self ) :
+
+		script = self.__scene()
+		frustumCull = script["frustumCull"]
+
+		script["sphere"]["transform"]["translate"]["x"].setValue( 5 )
+		self.assertTrue( frustumCull.culled( "/group/sphere" ) )
+
+		frustumCull["padding"].setValue( 1 )
+		self.assertFalse( frustumCull.culled( "/group/sphere" ) )
+
+	def testOverscan( self ) :
+
+		script = self.__scene()
+		frustumCull = script["frustumCull"]
+
+		script["sphere"]["transform"]["translate"]["x"].setValue( 5 )
+		self.assertTrue( frustumCull.culled( "/group/sphere" ) )
+
+		script["options"]["options"]["overscan"]["enabled"].setValue( True )
+		script["options"]["options"]["overscan"]["value"].setValue( True )
+		script["options"]["options"]["overscanRight"]["enabled"].setValue( True )
+		script["options"]["options"]["overscanRight"]["value"].setValue( 1 )
+		self.assertFalse( frustumCull.culled( "/group/sphere" ) )
+
+	def testMotionBlur( self ) :
+
+		script = self.__scene()
+		frustumCull = script["frustumCull"]
+
+		script["expression"] = Gaffer.Expression()
+		script["expression"].setExpression( 'parent["sphere"]["transform"]["translate"]["x"] = ( context.getFrame() - 1.25 ) * 40' )
+
+		with Gaffer.Context() as context :
+
+			context.setFrame( 1 )
+			self.assertTrue( frustumCull.culled( "/group/sphere" ) )
+
+			script["options"]["options"]["transformBlur"]["enabled"].setValue( True )
+			script["options"]["options"]["transformBlur"]["value"].setValue( True )
+			self.assertFalse( frustumCull.culled( "/group/sphere" ) )
+
+	def testLightsAndCamerasNotCulled( self ) :
+
+		script = self.__scene()
+		frustumCull = script["frustumCull"]
+
+		self.assertFalse( frustumCull.culled( "/group/light" ) )
+		self.assertFalse( frustumCull.culled( "/group/camera" ) )
+
+		# Ancestors of lights must not be culled either.
+		script["filter"]["paths"].setValue( IECore.StringVectorData( [ "/group" ] ) )
+		script["sphere"]["transform"]["translate"]["z"].setValue( 5 )
+		self.assertFalse( frustumCull.culled( "/group" ) )
+
+	def testPassThroughs( self ) :
+
+		script = self.__scene()
+		frustumCull = script["frustumCull"]
+		script["sphere"]["transform"]["translate"]["z"].setValue( 5 )
+
+		for path in [ "/", "/group", "/group/light", "/group/camera" ] :
+			self.assertEqual( frustumCull["out"].attributesHash( path ), frustumCull["in"].attributesHash( path ) )
+
+		self.assertNotEqual( frustumCull["out"].attributesHash( "/group/sphere" ), frustumCull["in"].attributesHash( "/group/sphere" ) )
+
+		self.assertEqual( frustumCull["out"].childNames( "/group" ), frustumCull["in"].childNames( "/group" ) )
+		self.assertEqual( frustumCull["out"].object( "/group/sphere" ), frustumCull["in"].object( "/group/sphere" ) )
+		self.assertEqual( frustumCull["out"].set( "__lights" ), frustumCull["in"].set( "__lights" ) )
+
+	def testExcludedPathsComputedOnce( self ) :
+
+		script = self.__scene()
+		frustumCull = script["frustumCull"]
+
+		with Gaffer.ContextMonitor( frustumCull ) as monitor :
+			for path in [ "/group/sphere", "/group/light", "/group/camera" ] :
+				frustumCull["out"].attributes( path )
+
+		statistics = monitor.plugStatistics( frustumCull["__excludedPaths"] )
+		self.assertEqual( statistics.numUniqueContexts(), 1 )
+		self.assertNotIn( "scene:path", statistics.variableNames() )
+
+	def testAffects( self ) :
+
+		frustumCull = GafferScene.FrustumCull()
+		for plug in [ frustumCull["padding"], frustumCull["__excludedPaths"], frustumCull["in"]["transform"], frustumCull["in"]["bound"] ] :
+			self.assertIn( frustumCull["out"]["attributes"], frustumCull.affects( plug ) )
+
+		self.assertIn( frustumCull["__excludedPaths"], frustumCull.affects( frustumCull["in"]["set"] ) )
+
+if __name__ == "__main__":
+	unittest.main()
@@ -0,0 +1,109 @@
+##########################################################################
+#
+#  Copyright (c) 2026, Image Engine Design Inc. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+
+import unittest
+import imath
+
+import IECore
+import IECoreScene
+
+import GafferTest
+import GafferScene
+
+class CapturingRendererTest( GafferTest.TestCase ) :
+
+	def testFactory( self ) :
+
+		self.assertTrue( "Capturing" in GafferScene.Private.IECoreScenePreview.Renderer.types() )
+
+		r = GafferScene.Private.IECoreScenePreview.Renderer.create( "Capturing" )
+		self.assertTrue( isinstance( r, GafferScene.Private.IECoreScenePreview.Renderer ) )
+		self.assertEqual( r.name(), "Capturing" )
+
+	def testCapture( self ) :
+
+		renderer = GafferScene.Private.IECoreScenePreview.Renderer.create(
+			"Capturing",
+			GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Interactive
+		)
+
+		attributes = renderer.attributes(
+			IECore.CompoundObject( {
+				"user:test" : IECore.IntData( 1 ),
+			} )
+		)
+		self.assertEqual( renderer.command( "capturing:numAttributesCalls", {} ), 1 )
+
+		sphereObject = IECoreScene.SpherePrimitive()
+		o = renderer.object( "/sphere", sphereObject, attributes )
+		o.transform( imath.M44f().translate( imath.V3f( 1, 2, 3 ) ) )
+		renderer.object( "/sphereInstance", sphereObject, attributes )
+
+		objects = renderer.command( "capturing:objects", {} )
+		self.assertEqual( sorted( objects.keys() ), [ "/sphere", "/sphereInstance" ] )
+		self.assertEqual( objects["/sphere"]["objectId"], objects["/sphereInstance"]["objectId"] )
+		sphereId = objects["/sphere"]["objectId"].value
+
+		sphere = objects["/sphere"]
+		self.assertEqual( sphere["transform"].value, imath.M44f().translate( imath.V3f( 1, 2, 3 ) ) )
+		self.assertEqual( sphere["attributes"], IECore.CompoundData( { "user:test" : IECore.IntData( 1 ) } ) )
+		self.assertEqual( sphere["numObjectCalls"].value, 1 )
+		self.assertEqual( sphere["numTransformEdits"].value, 1 )
+		self.assertEqual( sphere["numSamples"].value, 1 )
+
+		# Recreating an object replaces it, and is counted.
+
+		renderer.object(
+			"/sphere",
+			[ IECoreScene.SpherePrimitive( 1 ), IECoreScene.SpherePrimitive( 2 ) ],
+			[ 0, 1 ],
+			attributes
+		)
+
+		sphere = renderer.command( "capturing:objects", {} )["/sphere"]
+		self.assertEqual( sphere["numObjectCalls"].value, 2 )
+		self.assertEqual( sphere["numSamples"].value, 2 )
+		self.assertEqual( sphere["sampleTimes"], IECore.FloatVectorData( [ 0, 1 ] ) )
+		self.assertEqual( sphere["transform"].value, imath.M44f() )
+		self.assertNotEqual( sphere["objectId"].value, sphereId )
+
+		renderer.command( "capturing:clear", {} )
+		self.assertEqual( renderer.command( "capturing:objects", {} ), IECore.CompoundData() )
+		self.assertEqual( renderer.command( "capturing:numAttributesCalls", {} ), 0 )
+
+if __name__ == "__main__":
+	unittest.main()
@@ -957,5 +957,169 @@ class InstancerTest( GafferSceneTest.SceneTestCase ) :
 
 		self.assertEqual( instancer["out"].set( "A" ).value.paths(), [ "/plane" ] )
 
+	def testEncapsulateInstanceGroups( self ) :
+
+		points = IECoreScene.PointsPrimitive( IECore.V3fVectorData( [ imath.V3f( x, 0, 0 ) for x in range( 0, 4 ) ] ) )
+		points["index"] = IECoreScene.PrimitiveVariable(
+			IECoreScene.PrimitiveVariable.Interpolation.Vertex,
+			IECore.IntVectorData( [ 0, 1, 0, 1 ] ),
+		)
+
+		objectToScene = GafferScene.ObjectToScene()
+		objectToScene["object"].setValue( points )
+
+		sphere = GafferScene.Sphere()
+		sphere["sets"].setValue( "sphereSet" )
+		cube = GafferScene.Cube()
+		instances = GafferScene.Parent()
+		instances["in"].setInput( sphere["out"] )
+		instances["child"].setInput( cube["out"] )
+		instances["parent"].setValue( "/" )
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( objectToScene["out"] )
+		instancer["instances"].setInput( instances["out"] )
+		instancer["parent"].setValue( "/object" )
+		instancer["index"].setValue( "index" )
+
+		self.assertEqual( instancer["out"].childNames( "/object/instances/sphere" ), IECore.InternedStringVectorData( [ "0", "2" ] ) )
+		self.assertEqual( instancer["out"].set( "sphereSet" ).value.paths(), [ "/object/instances/sphere/0", "/object/instances/sphere/2" ] )
+		bounds = { n : instancer["out"].bound( "/object/instances/" + n ) for n in ( "sphere", "cube" ) }
+
+		instancer["encapsulateInstanceGroups"].setValue( True )
+
+		self.assertEqual( instancer["out"].childNames( "/object/instances" ), IECore.InternedStringVectorData( [ "sphere", "cube" ] ) )
+		self.assertEqual( instancer["out"].set( "sphereSet" ).value.paths(), [] )
+
+		for name in ( "sphere", "cube" ) :
+
+			path = "/object/instances/" + name
+			self.assertEqual( instancer["out"].childNames( path ), IECore.InternedStringVectorData() )
+			self.assertEqual( instancer["out"].bound( path ), bounds[name] )
+
+			capsule = instancer["out"].object( path )
+			self.assertIsInstance( capsule, GafferScene.Capsule )
+			self.assertEqual( capsule.root(), path )
+			self.assertEqual( capsule.bound(), bounds[name] )
+
+		self.assertSceneValid( instancer["out"] )
+
+		# The capsules must be updated when the instances change.
+
+		capsuleHash = instancer["out"].objectHash( "/object/instances/sphere" )
+		sphere["radius"].setValue( 2 )
+		self.assertNotEqual( instancer["out"].objectHash( "/object/instances/sphere" ), capsuleHash )
+		self.assertEqual(
+			instancer["out"].object( "/object/instances/sphere" ).bound(),
+			instancer["out"].bound( "/object/instances/sphere" )
+		)
+
+		instancer["encapsulateInstanceGroups"].setValue( False )
+		self.assertEqual( instancer["out"].childNames( "/object/instances/sphere" ), IECore.InternedStringVectorData( [ "0", "2" ] ) )
+
+	def testEncapsulatedRender( self ) :
+
+		points = IECoreScene.PointsPrimitive( IECore.V3fVectorData( [ imath.V3f( x, x * 2, 0 ) for x in range( 0, 3 ) ] ) )
+		points["testFloat"] = IECoreScene.PrimitiveVariable(
+			IECoreScene.PrimitiveVariable.Interpolation.Vertex,
+			IECore.FloatVectorData( [ 0, 1, 2 ] ),
+		)
+		points["orientation"] = IECoreScene.PrimitiveVariable(
+			IECoreScene.PrimitiveVariable.Interpolation.Vertex,
+			IECore.QuatfVectorData( [ imath.Eulerf( 0, x, 0 ).toQuat() for x in range( 0, 3 ) ] ),
+		)
+
+		objectToScene = GafferScene.ObjectToScene()
+		objectToScene["object"].setValue( points )
+		objectToScene["transform"]["translate"].setValue( imath.V3f( 0, 0, 5 ) )
+
+		# Prototype with a child location, and attributes at both
+		# the prototype root and the child.
+
+		sphere = GafferScene.Sphere()
+		sphere["transform"]["translate"].setValue( imath.V3f( 1, 0, 0 ) )
+		cube = GafferScene.Cube()
+		cube["transform"]["translate"].setValue( imath.V3f( 0, 2, 0 ) )
+
+		parent = GafferScene.Parent()
+		parent["in"].setInput( sphere["out"] )
+		parent["child"].setInput( cube["out"] )
+		parent["parent"].setValue( "/sphere" )
+
+		rootFilter = GafferScene.PathFilter()
+		rootFilter["paths"].setValue( IECore.StringVectorData( [ "/sphere" ] ) )
+
+		rootAttributes = GafferScene.CustomAttributes()
+		rootAttributes["in"].setInput( parent["out"] )
+		rootAttributes["filter"].setInput( rootFilter["out"] )
+		rootAttributes["attributes"].addMember( "testFloat", IECore.FloatData( 10 ) )
+		rootAttributes["attributes"].addMember( "rootOnly", IECore.IntData( 1 ) )
+
+		childFilter = GafferScene.PathFilter()
+		childFilter["paths"].setValue( IECore.StringVectorData( [ "/sphere/cube" ] ) )
+
+		childAttributes = GafferScene.CustomAttributes()
+		childAttributes["in"].setInput( rootAttributes["out"] )
+		childAttributes["filter"].setInput( childFilter["out"] )
+		childAttributes["attributes"].addMember( "testFloat", IECore.FloatData( 20 ) )
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( objectToScene["out"] )
+		instancer["instances"].setInput( childAttributes["out"] )
+		instancer["parent"].setValue( "/object" )
+		instancer["orientation"].setValue( "orientation" )
+		instancer["attributes"].setValue( "testFloat" )
+
+		# Render the regular hierarchy, to give us a reference.
+
+		renderer = GafferScene.Private.IECoreScenePreview.Renderer.create(
+			"Capturing",
+			GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Interactive
+		)
+		controller = GafferScene.RenderController( instancer["out"], Gaffer.Context(), renderer )
+		controller.setMinimumExpansionDepth( 10 )
+		controller.update()
+		expanded = renderer.command( "capturing:objects", {} )
+
+		# Render the capsule, which names objects and specifies transforms
+		# relative to the capsule's location.
+
+		instancer["encapsulateInstanceGroups"].setValue( True )
+		capsule = instancer["out"].object( "/object/instances/sphere" )
+		capsuleTransform = instancer["out"].fullTransform( "/object/instances/sphere" )
+
+		renderer = GafferScene.Private.IECoreScenePreview.Renderer.create(
+			"Capturing",
+			GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Interactive
+		)
+		capsule.render( renderer )
+		encapsulated = renderer.command( "capturing:objects", {} )
+
+		expectedNames = []
+		for i in range( 0, 3 ) :
+			expectedNames.extend( [ "/{}".format( i ), "/{}/cube".format( i ) ] )
+		self.assertEqual( sorted( encapsulated.keys() ), sorted( expectedNames ) )
+
+		for name in expectedNames :
+
+			reference = expanded["/object/instances/sphere" + name]
+			captured = encapsulated[name]
+
+			self.assertTrue(
+				( captured["transform"].value * capsuleTransform ).equalWithAbsError(
+					reference["transform"].value, 0.00001
+				)
+			)
+			self.assertEqual( captured["attributes"], reference["attributes"] )
+
+		# Per-instance attributes take precedence over attributes at the
+		# prototype root, but attributes beneath the root take precedence
+		# over both.
+
+		self.assertEqual( encapsulated["/2"]["attributes"]["testFloat"], IECore.FloatData( 2 ) )
+		self.assertEqual( encapsulated["/2"]["attributes"]["rootOnly"], IECore.IntData( 1 ) )
+		self.assertEqual( encapsulated["/2/cube"]["attributes"]["testFloat"], IECore.FloatData( 20 ) )
+		self.assertEqual( encapsulated["/2/cube"]["attributes"]["rootOnly"], IECore.IntData( 1 ) )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -0,0 +1,178 @@
+##########################################################################
+#
+#  Copyright (c) 2026, Image Engine Design Inc. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+
+import unittest
+
+import imath
+
+import IECore
+
+import Gaffer
+import GafferScene
+import GafferSceneTest
+
+class LevelOfDetailTest( GafferSceneTest.SceneTestCase ) :
+
+	def __scene( self ) :
+
+		script = Gaffer.ScriptNode()
+
+		script["sphere"] = GafferScene.Sphere()
+
+		script["lod"] = GafferScene.Group()
+		script["lod"]["name"].setValue( "lod" )
+		for i in range( 0, 3 ) :
+			script["lod"]["in"][i].setInput( script["sphere"]["out"] )
+
+		script["camera"] = GafferScene.Camera()
+
+		script["group"] = GafferScene.Group()
+		script["group"]["in"][0].setInput( script["lod"]["out"] )
+		script["group"]["in"][1].setInput( script["camera"]["out"] )
+
+		script["options"] = GafferScene.StandardOptions()
+		script["options"]["in"].setInput( script["group"]["out"] )
+		script["options"]["options"]["renderCamera"]["enabled"].setValue( True )
+		script["options"]["options"]["renderCamera"]["value"].setValue( "/group/camera" )
+
+		script["filter"] = GafferScene.PathFilter()
+		script["filter"]["paths"].setValue( IECore.StringVectorData( [ "/group/lod" ] ) )
+
+		script["levelOfDetail"] = GafferScene.LevelOfDetail()
+		script["levelOfDetail"]["in"].setInput( script["options"]["out"] )
+		script["levelOfDetail"]["filter"].setInput( script["filter"]["out"] )
+
+		return script
+
+	def __visibleChildren( self, scene ) :
+
+		result = []
+		for name in scene.childNames( "/group/lod" ) :
+			attributes = scene.attributes( "/group/lod/" + str( name ) )
+			if "scene:visible" not in attributes or attributes["scene:visible"].value :
+				result.append( str( name ) )
+
+		return result
+
+	def test( self ) :
+
+		script = self.__scene()
+		levelOfDetail = script["levelOfDetail"]
+
+		for distance, representation in [
+			( 5, 0 ),
+			( 30, 1 ),
+			( 200, 2 ),
+			( 10000, 2 ),
+		] :
+			script["lod"]["transform"]["translate"]["z"].setValue( -distance )
+			self.assertEqual( levelOfDetail.representation( "/group/lod" ), representation )
+			self.assertEqual(
+				self.__visibleChildren( levelOfDetail["out"] ),
+				[ str( levelOfDetail["out"].childNames( "/group/lod" )[representation] ) ]
+			)
+			self.assertSceneValid( levelOfDetail["out"] )
+
+	def testMovingCamera( self ) :
+
+		script = self.__scene()
+		levelOfDetail = script["levelOfDetail"]
+
+		script["lod"]["transform"]["translate"]["z"].setValue( -5 )
+		self.assertEqual( levelOfDetail.representation( "/group/lod" ), 0 )
+
+		script["camera"]["transform"]["translate"]["z"].setValue( 195 )
+		self.assertEqual( levelOfDetail.representation( "/group/lod" ), 2 )
+		self.assertEqual( self.__visibleChildren( levelOfDetail["out"] ), [ "sphere2" ] )
+
+	def testBehindCamera( self ) :
+
+		script = self.__scene()
+		levelOfDetail = script["levelOfDetail"]
+
+		# A distant group behind the camera must not be mistaken
+		# for one surrounding the camera.
+		script["lod"]["transform"]["translate"]["z"].setValue( 200 )
+		self.assertEqual( levelOfDetail.representation( "/group/lod" ), 2 )
+		self.assertEqual( self.__visibleChildren( levelOfDetail["out"] ), [ "sphere2" ] )
+
+		script["lod"]["transform"]["translate"]["z"].setValue( 0.5 )
+		self.assertEqual( levelOfDetail.representation( "/group/lod" ), 0 )
+
+	def testPassThroughs( self ) :
+
+		script = self.__scene()
+		levelOfDetail = script["levelOfDetail"]
+		script["lod"]["transform"]["translate"]["z"].setValue( -200 )
+
+		for path in [ "/", "/group", "/group/lod", "/group/camera" ] :
+			self.assertEqual( levelOfDetail["out"].attributesHash( path ), levelOfDetail["in"].attributesHash( path ) )
+
+		self.assertEqual( levelOfDetail["out"].attributesHash( "/group/lod/sphere2" ), levelOfDetail["in"].attributesHash( "/group/lod/sphere2" ) )
+		self.assertNotEqual( levelOfDetail["out"].attributesHash( "/group/lod/sphere" ), levelOfDetail["in"].attributesHash( "/group/lod/sphere" ) )
+
+		self.assertEqual( levelOfDetail["out"].childNames( "/group/lod" ), levelOfDetail["in"].childNames( "/group/lod" ) )
+		self.assertEqual( levelOfDetail["out"].set( "__cameras" ), levelOfDetail["in"].set( "__cameras" ) )
+
+	def testMotionBlur( self ) :
+
+		script = self.__scene()
+		levelOfDetail = script["levelOfDetail"]
+		script["lod"]["transform"]["translate"]["z"].setValue( -200 )
+
+		script["expression"] = Gaffer.Expression()
+		script["expression"].setExpression( 'parent["camera"]["transform"]["translate"]["z"] = ( 1 - context.getFrame() ) * 780' )
+
+		with Gaffer.Context() as context :
+
+			context.setFrame( 1 )
+			self.assertEqual( levelOfDetail.representation( "/group/lod" ), 2 )
+
+			# The camera passes close to the group during the shutter,
+			# so the highest detail representation must be used.
+			script["options"]["options"]["transformBlur"]["enabled"].setValue( True )
+			script["options"]["options"]["transformBlur"]["value"].setValue( True )
+			self.assertEqual( levelOfDetail.representation( "/group/lod" ), 0 )
+
+	def testAffects( self ) :
+
+		levelOfDetail = GafferScene.LevelOfDetail()
+		for plug in [ levelOfDetail["thresholds"], levelOfDetail["in"]["transform"], levelOfDetail["in"]["bound"] ] :
+			self.assertIn( levelOfDetail["out"]["attributes"], levelOfDetail.affects( plug ) )
+
+if __name__ == "__main__":
+	unittest.main()
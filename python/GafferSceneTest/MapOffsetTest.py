@@ -72,5 +72,20 @@ class MapOffsetTest( GafferSceneTest.SceneTestCase ) :
 		for i, uv in enumerate( offset["out"].object( "/plane" )["uv"].data ) :
 			self.assertEqual( uv, imath.V2f( inputObject["uv"].data[i] + imath.V2f( 1.5, 3.5 ) ) )
 
+	def testUnmodifiedDataIsShared( self ) :
+
+		plane = GafferScene.Plane()
+		offset = GafferScene.MapOffset()
+		offset["in"].setInput( plane["out"] )
+		offset["offset"].setValue( imath.V2f( 1 ) )
+
+		inputObject = plane["out"].object( "/plane", _copy = False )
+		outputObject = offset["out"].object( "/plane", _copy = False )
+
+		self.assertFalse( outputObject["uv"].data.isSame( inputObject["uv"].data ) )
+		for name in inputObject.keys() :
+			if name != "uv" :
+				self.assertTrue( outputObject[name].data.isSame( inputObject[name].data ) )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -203,5 +203,170 @@ class RenderControllerTest( GafferSceneTest.SceneTestCase ) :
 			lightSet["out"].bound( "/" )
 		)
 
+	def testUpdateEditedPaths( self ) :
+
+		sphere = GafferScene.Sphere()
+		group = GafferScene.Group()
+		group["in"][0].setInput( sphere["out"] )
+		group["in"][1].setInput( sphere["out"] )
+
+		pathFilter = GafferScene.PathFilter()
+		pathFilter["paths"].setValue( IECore.StringVectorData( [ "/group/sphere" ] ) )
+
+		transform = GafferScene.Transform()
+		transform["in"].setInput( group["out"] )
+		transform["filter"].setInput( pathFilter["out"] )
+
+		self.assertEqual( pathFilter.knownMatches(), IECore.PathMatcher( [ "/group/sphere" ] ) )
+		self.assertEqual(
+			transform.affectedPaths( transform["transform"]["translate"]["x"] ),
+			IECore.PathMatcher( [ "/group/sphere" ] )
+		)
+		self.assertEqual( transform.affectedPaths( transform["in"]["transform"] ), None )
+		self.assertEqual( transform.affectedPaths( transform["filter"] ), None )
+
+		# Render the scene via a plug on another node, so that the controller
+		# must track the dirtiness of the source node.
+
+		node = Gaffer.Node()
+		node["in"] = GafferScene.ScenePlug()
+		node["in"].setInput( transform["out"] )
+
+		renderer = GafferScene.Private.IECoreScenePreview.Renderer.create(
+			"OpenGL",
+			GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Interactive
+		)
+		controller = GafferScene.RenderController( node["in"], Gaffer.Context(), renderer )
+		controller.setMinimumExpansionDepth( 3 )
+		controller.update()
+
+		def bound( path ) :
+
+			renderer.option( "gl:selection", IECore.PathMatcherData( IECore.PathMatcher( [ path ] ) ) )
+			return renderer.command( "gl:queryBound", { "selection" : True } )
+
+		def assertBoundsUpdated() :
+
+			for path in ( "/group/sphere", "/group/sphere1" ) :
+				self.assertEqual( bound( path ), transform["out"].bound( path ) * transform["out"].fullTransform( path ) )
+
+		assertBoundsUpdated()
+
+		def updateAndCountVisitedPaths() :
+
+			# Edits clear the hash cache, so every location visited by
+			# the update must hash the transform again, in a context
+			# containing its path.
+			with Gaffer.ContextMonitor( transform ) as monitor :
+				controller.update()
+
+			statistics = monitor.plugStatistics( transform["out"]["transform"] )
+			if "scene:path" not in statistics.variableNames() :
+				return 0
+
+			return statistics.numUniqueValues( "scene:path" )
+
+		# Edit to the Transform node itself, affecting only the filtered location.
+		# The sibling location must not be visited at all.
+
+		transform["transform"]["translate"]["x"].setValue( 2 )
+		self.assertEqual( updateAndCountVisitedPaths(), 1 )
+		assertBoundsUpdated()
+
+		transform["transform"]["translate"]["x"].setValue( 3 )
+		self.assertEqual( updateAndCountVisitedPaths(), 1 )
+		assertBoundsUpdated()
+
+		# Edit to the filter, affecting the previously matched location as well.
+		# This can't be attributed to specific locations, so everything is visited.
+
+		pathFilter["paths"].setValue( IECore.StringVectorData( [ "/group/sphere1" ] ) )
+		self.assertEqual( updateAndCountVisitedPaths(), 4 )
+		assertBoundsUpdated()
+
+		# Edit to the Transform node, now visiting only the newly
+		# matched location.
+
+		transform["transform"]["translate"]["x"].setValue( 4 )
+		self.assertEqual( updateAndCountVisitedPaths(), 1 )
+		assertBoundsUpdated()
+
+		# Edit upstream of the Transform node, affecting everything.
+
+		sphere["radius"].setValue( 2 )
+		controller.update()
+		assertBoundsUpdated()
+
+		group["transform"]["translate"]["y"].setValue( 1 )
+		controller.update()
+		assertBoundsUpdated()
+
+		# Edit to the Transform node after reconnecting the render
+		# directly to it.
+
+		controller.setScene( transform["out"] )
+		controller.update()
+		transform["transform"]["translate"]["z"].setValue( 3 )
+		controller.update()
+		assertBoundsUpdated()
+
+	def testObjectsSharedByHash( self ) :
+
+		sphere = GafferScene.Sphere()
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( sphere["out"] )
+		duplicate["target"].setValue( "/sphere" )
+		duplicate["transform"]["translate"]["x"].setValue( 2 )
+		duplicate["copies"].setValue( 4 )
+
+		cube = GafferScene.Cube()
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( duplicate["out"] )
+		group["in"][1].setInput( cube["out"] )
+
+		# Turn off the compute cache, so that any sharing must come from the
+		# controller itself rather than from identical hashes being served from
+		# the cache.
+
+		originalCacheMemoryLimit = Gaffer.ValuePlug.getCacheMemoryLimit()
+		self.addCleanup( Gaffer.ValuePlug.setCacheMemoryLimit, originalCacheMemoryLimit )
+		Gaffer.ValuePlug.setCacheMemoryLimit( 0 )
+
+		renderer = GafferScene.Private.IECoreScenePreview.Renderer.create(
+			"Capturing",
+			GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Interactive
+		)
+		controller = GafferScene.RenderController( group["out"], Gaffer.Context(), renderer )
+		controller.setMinimumExpansionDepth( 3 )
+
+		spheres = [ "/group/sphere" ] + [ "/group/sphere%d" % i for i in range( 1, 5 ) ]
+
+		def assertShared() :
+
+			objects = renderer.command( "capturing:objects", {} )
+			self.assertEqual( set( objects.keys() ), set( spheres + [ "/group/cube" ] ) )
+
+			# Every sphere was given the same object, which was
+			# only computed once.
+			sphereIds = set( objects[s]["objectId"].value for s in spheres )
+			self.assertEqual( len( sphereIds ), 1 )
+			self.assertNotEqual( objects["/group/cube"]["objectId"].value, sphereIds.pop() )
+
+		controller.update()
+		assertShared()
+
+		# Editing the sphere creates new objects, which are shared
+		# in the same way.
+
+		sphere["radius"].setValue( 2 )
+		controller.update()
+		assertShared()
+
+		objects = renderer.command( "capturing:objects", {} )
+		for s in spheres :
+			self.assertEqual( objects[s]["numObjectCalls"].value, 2 )
+		self.assertEqual( objects["/group/cube"]["numObjectCalls"].value, 1 )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -38,6 +38,7 @@ import unittest
 
 import IECore
 
+import Gaffer
 import GafferScene
 import GafferSceneTest
 
@@ -75,6 +76,99 @@ class RendererAlgoTest( GafferSceneTest.SceneTestCase ) :
 		self.assertScenesEqual( defaultAdaptors["out"], defaultAdaptors2["out"] )
 		self.assertSceneHashesEqual( defaultAdaptors["out"], defaultAdaptors2["out"] )
 
+	def testObjectSamples( self ) :
+
+		# Switch from sphereA to sphereB part way through the shutter,
+		# so that the last two motion samples have identical hashes.
+
+		script = Gaffer.ScriptNode()
+
+		script["sphereA"] = GafferScene.Sphere()
+		script["sphereB"] = GafferScene.Sphere()
+		script["sphereB"]["radius"].setValue( 2 )
+
+		script["switch"] = Gaffer.Switch()
+		script["switch"].setup( GafferScene.ScenePlug() )
+		script["switch"]["in"][0].setInput( script["sphereA"]["out"] )
+		script["switch"]["in"][1].setInput( script["sphereB"]["out"] )
+
+		script["expression"] = Gaffer.Expression()
+		script["expression"].setExpression( 'parent["switch"]["index"] = 0 if context.getFrame() < 1 else 1' )
+
+		script["filter"] = GafferScene.PathFilter()
+		script["filter"]["paths"].setValue( IECore.StringVectorData( [ "/sphere" ] ) )
+
+		script["attributes"] = GafferScene.StandardAttributes()
+		script["attributes"]["in"].setInput( script["switch"]["out"] )
+		script["attributes"]["filter"].setInput( script["filter"]["out"] )
+		script["attributes"]["attributes"]["deformationBlurSegments"]["enabled"].setValue( True )
+		script["attributes"]["attributes"]["deformationBlurSegments"]["value"].setValue( 2 )
+
+		script["options"] = GafferScene.StandardOptions()
+		script["options"]["in"].setInput( script["attributes"]["out"] )
+		script["options"]["options"]["deformationBlur"]["enabled"].setValue( True )
+		script["options"]["options"]["deformationBlur"]["value"].setValue( True )
+
+		# Turn off the compute cache, so that we can count exactly
+		# how many samples are computed.
+
+		originalCacheMemoryLimit = Gaffer.ValuePlug.getCacheMemoryLimit()
+		self.addCleanup( Gaffer.ValuePlug.setCacheMemoryLimit, originalCacheMemoryLimit )
+		Gaffer.ValuePlug.setCacheMemoryLimit( 0 )
+
+		def render() :
+
+			context = Gaffer.Context()
+			context.setFrame( 1 )
+
+			capsule = GafferScene.Capsule(
+				script["options"]["out"],
+				"/",
+				context,
+				IECore.MurmurHash(),
+				script["options"]["out"].bound( "/" )
+			)
+
+			renderer = GafferScene.Private.IECoreScenePreview.Renderer.create(
+				"Capturing",
+				GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Batch
+			)
+
+			with Gaffer.PerformanceMonitor() as monitor :
+				capsule.render( renderer )
+
+			return renderer.command( "capturing:objects", {} )["/sphere"], monitor
+
+		# Three samples, at 0.75, 1 and 1.25. The identical samples
+		# from sphereB are only computed once.
+
+		sphere, monitor = render()
+		self.assertEqual( sphere["numSamples"].value, 3 )
+		self.assertEqual( sphere["sampleTimes"], IECore.FloatVectorData( [ 0.75, 1, 1.25 ] ) )
+		self.assertEqual( monitor.plugStatistics( script["sphereA"]["out"]["object"] ).computeCount, 1 )
+		self.assertEqual( monitor.plugStatistics( script["sphereB"]["out"]["object"] ).computeCount, 1 )
+
+		# When all the samples have identical hashes, only a single
+		# sample is computed and output.
+
+		script["expression"].setExpression( 'parent["switch"]["index"] = 1' )
+
+		sphere, monitor = render()
+		self.assertEqual( sphere["numSamples"].value, 1 )
+		self.assertEqual( sphere["sampleTimes"], IECore.FloatVectorData() )
+		self.assertEqual( monitor.plugStatistics( script["sphereA"]["out"]["object"] ).computeCount, 0 )
+		self.assertEqual( monitor.plugStatistics( script["sphereB"]["out"]["object"] ).computeCount, 1 )
+
+		# When the object changes type during the shutter, the samples
+		# can't be interpolated, so we fall back to the first sample alone.
+
+		script["expression"].setExpression( 'parent["switch"]["index"] = 0 if context.getFrame() < 1 else 1' )
+		script["sphereB"]["type"].setValue( GafferScene.Sphere.Type.Primitive )
+
+		sphere, monitor = render()
+		self.assertEqual( sphere["numSamples"].value, 1 )
+		self.assertEqual( sphere["sampleTimes"], IECore.FloatVectorData() )
+
 	def tearDown( self ) :
 
 		GafferSceneTest.SceneTestCase.tearDown( self )
@@ -37,6 +37,9 @@
 
 import unittest
 import threading
+import time
+
+import imath
 
 import IECore
 import IECoreScene
@@ -224,5 +227,105 @@ class SeedsTest( GafferSceneTest.SceneTestCase ) :
 		primitiveVariables["primitiveVariables"].addMember( "d", IECore.FloatData( 0.5 ) )
 		self.assertLessEqual( seeds["out"].object( "/plane/seeds" ).numPoints, p.numPoints )
 
+	def testMaxPoints( self ) :
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 100 ) )
+
+		seeds = GafferScene.Seeds()
+		seeds["in"].setInput( plane["out"] )
+		seeds["parent"].setValue( "/plane" )
+		seeds["density"].setValue( 10000 )
+
+		numPoints = seeds["out"].object( "/plane/seeds" ).numPoints
+		self.assertGreater( numPoints, 5000 )
+
+		seeds["maxPoints"].setValue( 1000 )
+		self.assertTrue( "out.object" in [ x.relativeName( seeds ) for x in seeds.affects( seeds["maxPoints"] ) ] )
+		self.assertLessEqual( seeds["out"].object( "/plane/seeds" ).numPoints, 1000 )
+		self.assertGreater( seeds["out"].object( "/plane/seeds" ).numPoints, 900 )
+
+		# The limit is never exceeded, and the points are still spread
+		# over the whole plane.
+
+		for maxPoints in ( 10, 100, 1000, 2000, 5000 ) :
+			seeds["maxPoints"].setValue( maxPoints )
+			points = seeds["out"].object( "/plane/seeds" )
+			self.assertLessEqual( points.numPoints, maxPoints )
+			if maxPoints >= 1000 :
+				y = [ p.y for p in points["P"].data ]
+				self.assertLess( min( y ), -0.4 )
+				self.assertGreater( max( y ), 0.4 )
+
+		seeds["maxPoints"].setValue( numPoints * 2 )
+		self.assertEqual( seeds["out"].object( "/plane/seeds" ).numPoints, numPoints )
+
+	def testDeterminism( self ) :
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 200 ) )
+
+		seeds = GafferScene.Seeds()
+		seeds["in"].setInput( plane["out"] )
+		seeds["parent"].setValue( "/plane" )
+		seeds["density"].setValue( 1000 )
+
+		# The thread count can only be limited on a thread which doesn't
+		# yet have a task scheduler, so each compute gets its own thread.
+
+		results = {}
+		def f( threads ) :
+
+			with IECore.tbb_task_scheduler_init( threads ) :
+				results[threads] = seeds["out"].object( "/plane/seeds" )
+
+		for threads in ( 1, 2, 3, IECore.tbb_task_scheduler_init.automatic ) :
+			Gaffer.ValuePlug.clearCache()
+			thread = threading.Thread( target = f, args = [ threads ] )
+			thread.start()
+			thread.join()
+
+		self.assertEqual( len( results ), 4 )
+		for threads, points in results.items() :
+			self.assertEqual( points, results[1] )
+
+	def testCancellation( self ) :
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 500 ) )
+
+		seeds = GafferScene.Seeds()
+		seeds["in"].setInput( plane["out"] )
+		seeds["parent"].setValue( "/plane" )
+		seeds["density"].setValue( 10000000 )
+
+		# Compute the input mesh up front, so that the cancellation
+		# lands in the distribution of the points.
+		plane["out"].object( "/plane" )
+
+		exceptions = []
+		def f( context ) :
+
+			with context :
+				try :
+					seeds["out"].object( "/plane/seeds" )
+				except IECore.Cancelled as e :
+					exceptions.append( e )
+
+		canceller = IECore.Canceller()
+		thread = threading.Thread(
+			target = f,
+			args = [ Gaffer.Context( Gaffer.Context(), canceller ) ]
+		)
+
+		# Give the background thread time to start distributing
+		# points, and then cancel it.
+		thread.start()
+		time.sleep( 0.1 )
+		canceller.cancel()
+		thread.join()
+
+		self.assertEqual( len( exceptions ), 1 )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -136,8 +136,12 @@ from CameraTweaksTest import CameraTweaksTest
 from FilterProcessorTest import FilterProcessorTest
 from UDIMQueryTest import UDIMQueryTest
 from WireframeTest import WireframeTest
+from LevelOfDetailTest import LevelOfDetailTest
+from FrustumCullTest import FrustumCullTest
+from CameraVisibilityProcessorTest import CameraVisibilityProcessorTest
 
 from IECoreGLPreviewTest import *
+from IECoreScenePreviewTest import *
 
 if __name__ == "__main__":
 	import unittest
@@ -0,0 +1,87 @@
+##########################################################################
+#
+#  Copyright (c) 2026, Image Engine Design Inc. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+
+import Gaffer
+import GafferScene
+
+Gaffer.Metadata.registerNode(
+
+	GafferScene.FrustumCull,
+
+	"description",
+	"""
+	Hides locations whose bounds lie entirely outside the
+	frustum of the render camera. Renderers do not traverse
+	below hidden locations, so the objects of culled locations
+	and their descendants are never evaluated. Lights and
+	cameras, and any locations containing them, are never
+	culled. Note that off screen objects may still contribute
+	to a raytraced render through shadows, reflections and
+	indirect lighting.
+	""",
+
+	plugs = {
+
+		"filter" : [
+
+			"description",
+			"""
+			The filter used to choose the locations to be tested
+			for culling. Testing a parent rather than all its
+			descendants is cheaper, and culls whole subtrees at
+			once.
+			""",
+
+		],
+
+		"padding" : [
+
+			"description",
+			"""
+			Expands the frustum on each side, as a fraction of the
+			size of the screen window. This is applied in addition
+			to any overscan, and guards against culling objects that
+			move into view during the shutter, or that are only
+			just off screen. When motion blur is on, locations are
+			tested at both shutter open and shutter close.
+			""",
+
+		],
+
+	}
+
+)
@@ -172,6 +172,25 @@ Gaffer.Metadata.registerNode(
 
 		],
 
+		"encapsulateInstanceGroups" : [
+
+			"description",
+			"""
+			Converts each group of instances into a capsule, which won't
+			be expanded until you render. The instances can't be modified
+			downstream of the Instancer, but they are much faster to generate
+			and render. Each location in the instances scene is evaluated
+			once, and is then output to the renderer once per point, so that
+			the renderer may instance it natively.
+
+			> Note : Lights and cameras within the instances are ignored. Only
+			> deformation blur is supported : the instances aren't motion
+			> blurred by the transforms of the points, nor by animated
+			> transforms within the instances themselves.
+			""",
+
+		],
+
 	}
 
 )
@@ -0,0 +1,86 @@
+##########################################################################
+#
+#  Copyright (c) 2026, Image Engine Design Inc. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+
+import Gaffer
+import GafferScene
+
+Gaffer.Metadata.registerNode(
+
+	GafferScene.LevelOfDetail,
+
+	"description",
+	"""
+	Chooses between alternative representations of an object
+	according to its size on screen. The filter specifies
+	"level of detail groups", and the children of each group
+	are treated as alternative representations, ordered from
+	highest to lowest detail. Only one child of each group
+	remains visible, so that distant objects are rendered
+	using cheaper representations, and the others are never
+	evaluated by the renderer.
+	""",
+
+	plugs = {
+
+		"filter" : [
+
+			"description",
+			"""
+			The filter used to specify the level of detail groups.
+			""",
+
+		],
+
+		"thresholds" : [
+
+			"description",
+			"""
+			The screen sizes at which to switch to the next
+			representation, in decreasing order. Screen size
+			is measured as the diameter of the group's bounding
+			sphere, as a fraction of the width of the screen
+			window. With the default thresholds, the first
+			child is used for groups larger than a quarter
+			of the screen, the second child for groups larger
+			than one twentieth, and the third child otherwise.
+			""",
+
+		],
+
+	}
+
+)
@@ -113,7 +113,20 @@ Gaffer.Metadata.registerNode(
 
 			"plugValueWidget:type", "GafferUI.PresetsPlugValueWidget",
 
-		]
+		],
+
+		"maxPoints" : [
+
+			"description",
+			"""
+			An upper limit on the number of points generated for
+			each mesh. When the density would produce more points
+			than this, it is reduced to approximately meet the budget,
+			and any remaining excess points are discarded evenly across
+			the mesh. A value of 0 means there is no limit.
+			""",
+
+		],
 
 	}
 
@@ -147,6 +147,9 @@ import PrimitiveVariableExistsUI
 import CollectTransformsUI
 import UDIMQueryUI
 import WireframeUI
+import CameraVisibilityProcessorUI
+import LevelOfDetailUI
+import FrustumCullUI
 
 # then all the PathPreviewWidgets. note that the order
 # of import controls the order of display.
@@ -41,14 +41,19 @@
 #include "Gaffer/ArrayPlug.h"
 #include "Gaffer/Context.h"
 #include "Gaffer/Dot.h"
+#include "Gaffer/NumericPlug.h"
 #include "Gaffer/Process.h"
 #include "Gaffer/ScriptNode.h"
 #include "Gaffer/SubGraph.h"
 
+#include "tbb/pipeline.h"
+
 using namespace IECore;
 using namespace Gaffer;
 using namespace GafferDispatch;
 
+static InternedString g_frameConcurrency( "frameConcurrency" );
+
 //////////////////////////////////////////////////////////////////////////
 // Task implementation
 //////////////////////////////////////////////////////////////////////////
@@ -426,16 +431,77 @@ void TaskNode::execute() const
 
 void TaskNode::executeSequence( const std::vector<float> &frames ) const
 {
-	Context::EditableScope timeScope( Context::current() );
+	const IntPlug *frameConcurrencyPlug = dispatcherPlug()->getChild<IntPlug>( g_frameConcurrency );
+	const size_t frameConcurrency = frameConcurrencyPlug && canExecuteFramesConcurrently() ? std::max( frameConcurrencyPlug->getValue(), 1 ) : 1;
 
-	for ( std::vector<float>::const_iterator it = frames.begin(); it != frames.end(); ++it )
+	if( frameConcurrency == 1 || frames.size() < 2 )
 	{
-		timeScope.setFrame( *it );
-		execute();
+		Context::EditableScope timeScope( Context::current() );
+
+		for ( std::vector<float>::const_iterator it = frames.begin(); it != frames.end(); ++it )
+		{
+			timeScope.setFrame( *it );
+			execute();
+		}
+		return;
 	}
+
+	// Execute several frames at once, so that the serial parts of
+	// `execute()` don't leave cores idle. We use a pipeline rather than
+	// a `parallel_for()` in a limited `task_arena`, because the pipeline
+	// limits the number of frames in flight without also limiting the
+	// threads available to the parallel computations within each frame.
+	// All frames share the compute cache, which already bounds memory
+	// usage - the concurrency should be chosen so that the working set
+	// for the concurrent frames fits within it.
+
+	const Context *context = Context::current();
+	std::vector<float>::const_iterator frameIt = frames.begin();
+
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_pipeline(
+
+		std::min( frameConcurrency, frames.size() ),
+
+		tbb::make_filter<void, float>(
+			tbb::filter::serial_in_order,
+			[&frameIt, &frames] ( tbb::flow_control &flowControl ) -> float {
+				if( frameIt == frames.end() )
+				{
+					flowControl.stop();
+					return 0.0f;
+				}
+				return *frameIt++;
+			}
+		) &
+
+		tbb::make_filter<float, void>(
+			tbb::filter::parallel,
+			[this, context] ( float frame ) {
+				ContextPtr frameContext = new Context( *context );
+				frameContext->setFrame( frame );
+				Context::Scope scopedContext( frameContext.get() );
+				execute();
+			}
+		),
+
+		// Prevents outer tasks silently cancelling our tasks
+		taskGroupContext
+
+	);
 }
 
 bool TaskNode::requiresSequenceExecution() const
 {
 	return false;
 }
+
+bool TaskNode::canExecuteFramesConcurrently() const
+{
+	return false;
+}
+
+void TaskNode::addFrameConcurrencyPlug()
+{
+	dispatcherPlug()->addChild( new IntPlug( g_frameConcurrency, Plug::In, 1, 1 ) );
+}
@@ -189,6 +189,7 @@ void Blur::hash( const ValuePlug *output, const Context *context, IECore::Murmur
 	if( output->parent<ValuePlug>() == filterScalePlug() )
 	{
 		radiusPlug()->getChild<ValuePlug>( output->getName() )->hash( h );
+		h.append( ImagePlug::resolutionLevel( context ) );
 	}
 }
 
@@ -208,8 +209,11 @@ void Blur::compute( ValuePlug *output, const Context *context ) const
 		// that we are just sampling straight back onto the same pixel centers, we know this isn't a
 		// problem for blur.
 
+		const float radius = radiusPlug()->getChild<FloatPlug>( output->getName() )->getValue() *
+			Format::resolutionScale( ImagePlug::resolutionLevel( context ) );
+
 		static_cast<FloatPlug *>( output )->setValue(
-			2.0f / filterSupport * ( 1.0f + radiusPlug()->getChild<FloatPlug>( output->getName() )->getValue() )
+			2.0f / filterSupport * ( 1.0f + radius )
 		);
 		return;
 	}
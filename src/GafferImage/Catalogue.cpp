@@ -48,6 +48,7 @@
 #include "Gaffer/ArrayPlug.h"
 #include "Gaffer/Context.h"
 #include "Gaffer/DownstreamIterator.h"
+#include "Gaffer/NumericPlug.h"
 #include "Gaffer/ParallelAlgo.h"
 #include "Gaffer/ScriptNode.h"
 #include "Gaffer/StringPlug.h"
@@ -59,6 +60,7 @@
 #include "boost/lexical_cast.hpp"
 #include "boost/unordered_map.hpp"
 
+#include <functional>
 #include <thread>
 
 using namespace std;
@@ -82,6 +84,61 @@ size_t hash_value( const Imath::V2i &v )
 
 IMATH_INTERNAL_NAMESPACE_HEADER_EXIT
 
+//////////////////////////////////////////////////////////////////////////
+// Utilities
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+typedef std::function<void ( const string &channelName, const Imath::V2i &tileOrigin, const IECore::MurmurHash &channelDataHash )> TileHashFunction;
+
+// Returns a hash of the pixel values and metadata of an image, from which
+// the AsynchronousSaver generates file names. Unlike `ImagePlug::imageHash()`,
+// this is the same for any identical image, regardless of how it was generated,
+// but it requires every tile to be computed, so must not be used on the UI
+// thread. The optional
+// `tileHashFunction` is called with the hash of `channelDataPlug()` for each
+// tile, allowing those to be gathered in the same pass.
+IECore::MurmurHash contentHash( const ImagePlug *image, const ImagePlug *metadataSource, const TileHashFunction &tileHashFunction = TileHashFunction() )
+{
+	IECore::MurmurHash result;
+	result.append( image->formatPlug()->getValue().getDisplayWindow() );
+	result.append( image->formatPlug()->getValue().getPixelAspect() );
+	result.append( image->dataWindowPlug()->getValue() );
+	metadataSource->metadataPlug()->getValue()->hash( result );
+	image->channelNamesPlug()->getValue()->hash( result );
+
+	typedef std::pair<IECore::MurmurHash, IECore::MurmurHash> TileHashes;
+	ImageAlgo::parallelGatherTiles(
+		image,
+		image->channelNamesPlug()->getValue()->readable(),
+		// Tile
+		[] ( const ImagePlug *imagePlug, const string &channelName, const Imath::V2i &tileOrigin )
+		{
+			return TileHashes(
+				imagePlug->channelDataPlug()->hash(),
+				imagePlug->channelDataPlug()->getValue()->Object::hash()
+			);
+		},
+		// Gather
+		[ &result, &tileHashFunction ] ( const ImagePlug *imagePlug, const string &channelName, const Imath::V2i &tileOrigin, const TileHashes &tileHashes )
+		{
+			if( tileHashFunction )
+			{
+				tileHashFunction( channelName, tileOrigin, tileHashes.first );
+			}
+			result.append( tileHashes.second );
+		},
+		Imath::Box2i(),
+		ImageAlgo::BottomToTop
+	);
+
+	return result;
+}
+
+} // namespace
+
 //////////////////////////////////////////////////////////////////////////
 // InternalImage.
 // This node type provides the internal implementation of the images
@@ -412,14 +469,17 @@ class Catalogue::InternalImage : public ImageNode
 				imageCopy->imageSwitch()->indexPlug()->setValue( 1 );
 
 				// If there's nowhere to save, then a saver is useless, so return null.
-				const string fileName = client->parent<Catalogue>()->generateFileName( imageCopy->outPlug() );
-				if( fileName.empty() )
+				// Note that we only resolve the directory here - the file name
+				// is generated from the image hash, which is computed on the
+				// background thread so as not to stall the UI.
+				const string directory = client->parent<Catalogue>()->saveDirectory();
+				if( directory.empty() )
 				{
 					return nullptr;
 				}
 
 				// Otherwise, make a saver and schedule its background execution.
-				Ptr saver = Ptr( new AsynchronousSaver( imageCopy, fileName ) );
+				Ptr saver = Ptr( new AsynchronousSaver( imageCopy, directory ) );
 				saver->registerClient( client );
 
 				// Note that the background thread doesn't own a reference to the saver -
@@ -474,41 +534,57 @@ class Catalogue::InternalImage : public ImageNode
 
 			private :
 
-				AsynchronousSaver( InternalImagePtr imageCopy, const std::string &fileName )
-					:	m_imageCopy( imageCopy )
+				AsynchronousSaver( InternalImagePtr imageCopy, const std::string &directory )
+					:	m_imageCopy( imageCopy ), m_directory( directory )
 				{
 					// Set up an ImageWriter to do the actual saving.
 					// We do all graph construction here in the main thread
 					// so that the background thread only does execution.
+					// We write to a temporary file which is renamed once
+					// complete, so that a partially written image can never
+					// be mistaken for a complete one. Tiled output allows
+					// the image to be loaded back on demand, one tile batch
+					// at a time, rather than decoding whole scanline blocks.
 					m_writer = new ImageWriter;
 					m_writer->inPlug()->setInput( m_imageCopy->outPlug() );
-					m_writer->fileNamePlug()->setValue( fileName );
+					m_writer->fileNamePlug()->setValue(
+						( m_directory / boost::filesystem::unique_path( ".%%%%-%%%%-%%%%-%%%%.tmp.exr" ) ).string()
+					);
+					m_writer->fileFormatSettingsPlug( "openexr" )->getChild<IntPlug>( "mode" )->setValue( ImageWriter::Tile );
 				}
 
 				void save( WeakPtr forWrapUp )
 				{
-					ImageAlgo::parallelGatherTiles(
+					// Generate the file name from the image contents, so that
+					// we can skip saving entirely when an identical image
+					// already exists on disk. At the same time, gather the
+					// hashes of the Display tiles, so that clients can reuse
+					// the existing cache entries.
+					const IECore::MurmurHash imageHash = contentHash(
 						m_imageCopy->copyChannels()->outPlug(),
-						m_imageCopy->copyChannels()->outPlug()->channelNamesPlug()->getValue()->readable(),
-						// Tile
-						[] ( const ImagePlug *imagePlug, const string &channelName, const Imath::V2i &tileOrigin )
+						m_imageCopy->outPlug(),
+						[ this ] ( const string &channelName, const Imath::V2i &tileOrigin, const IECore::MurmurHash &channelDataHash )
 						{
-							return imagePlug->channelDataPlug()->hash();
-						},
-						// Gather
-						[ this ] ( const ImagePlug *imagePlug, const string &channelName, const Imath::V2i &tileOrigin, const IECore::MurmurHash &tileHash )
-						{
-							channelDataHashes[TileIndex(channelName, tileOrigin)] = tileHash;
+							channelDataHashes[TileIndex(channelName, tileOrigin)] = channelDataHash;
 						}
 					);
 
+					m_fileName = ( m_directory / ( imageHash.toString() + ".exr" ) ).string();
+
+					const boost::filesystem::path tempFileName( m_writer->fileNamePlug()->getValue() );
 					try
 					{
-						m_writer->taskPlug()->execute();
+						if( !boost::filesystem::exists( m_fileName ) )
+						{
+							m_writer->taskPlug()->execute();
+							boost::filesystem::rename( tempFileName, m_fileName );
+						}
 					}
 					catch( const std::exception &e )
 					{
 						IECore::msg( IECore::Msg::Error, "Saving Catalogue image", e.what() );
+						boost::system::error_code ec;
+						boost::filesystem::remove( tempFileName, ec );
 					}
 
 					// Schedule execution of wrapUp() on the UI thread,
@@ -543,7 +619,7 @@ class Catalogue::InternalImage : public ImageNode
 				{
 					// Set up the client to read from the saved image
 					client->text()->enabledPlug()->setValue( false );
-					client->fileNamePlug()->source<StringPlug>()->setValue( m_writer->fileNamePlug()->getValue() );
+					client->fileNamePlug()->source<StringPlug>()->setValue( m_fileName );
 					client->imageSwitch()->indexPlug()->setValue( 0 );
 					// But force hashChannelData and computeChannelData to be called
 					// so that we can reuse the cache entries created by the original
@@ -556,6 +632,10 @@ class Catalogue::InternalImage : public ImageNode
 				}
 
 				InternalImagePtr m_imageCopy;
+				const boost::filesystem::path m_directory;
+				// Written by the background thread before wrapUp()
+				// is scheduled on the UI thread.
+				std::string m_fileName;
 				ImageWriterPtr m_writer;
 
 				std::thread m_thread;
@@ -834,6 +914,21 @@ std::string Catalogue::generateFileName( const Image *image ) const
 }
 
 std::string Catalogue::generateFileName( const ImagePlug *image ) const
+{
+	const string directory = saveDirectory();
+	if( directory.empty() )
+	{
+		return "";
+	}
+
+	boost::filesystem::path result( directory );
+	result /= image->imageHash().toString();
+	result.replace_extension( "exr" );
+
+	return result.string();
+}
+
+std::string Catalogue::saveDirectory() const
 {
 	string directory = directoryPlug()->getValue();
 	if( const ScriptNode *script = ancestor<ScriptNode>() )
@@ -851,16 +946,7 @@ std::string Catalogue::generateFileName( const ImagePlug *image ) const
 		return "";
 	}
 
-	if( directory.empty() )
-	{
-		return "";
-	}
-
-	boost::filesystem::path result( directory );
-	result /= image->imageHash().toString();
-	result.replace_extension( "exr" );
-
-	return result.string();
+	return directory;
 }
 
 void Catalogue::imageAdded( GraphComponent *graphComponent )
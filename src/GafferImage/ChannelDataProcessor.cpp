@@ -99,7 +99,22 @@ bool ChannelDataProcessor::channelEnabled( const std::string &channel ) const
 
 IECore::ConstFloatVectorDataPtr ChannelDataProcessor::computeChannelData( const std::string &channelName, const Imath::V2i &tileOrigin, const Gaffer::Context *context, const ImagePlug *parent ) const
 {
-	IECore::FloatVectorDataPtr outData = inPlug()->channelData( channelName, tileOrigin )->copy();
+	IECore::ConstFloatVectorDataPtr inData = inPlug()->channelData( channelName, tileOrigin );
+
+	float constantValue;
+	if( perPixel() && ImagePlug::isConstantTile( inData.get(), constantValue ) )
+	{
+		IECore::FloatVectorDataPtr outData = new IECore::FloatVectorData( std::vector<float>( 1, constantValue ) );
+		processChannelData( context, parent, channelName, outData );
+		return ImagePlug::constantTile( outData->readable()[0] );
+	}
+
+	IECore::FloatVectorDataPtr outData = inData->copy();
 	processChannelData( context, parent, channelName, outData );
 	return outData;
 }
+
+bool ChannelDataProcessor::perPixel() const
+{
+	return false;
+}
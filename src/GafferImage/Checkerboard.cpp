@@ -252,6 +252,7 @@ void Checkerboard::hashChannelData( const GafferImage::ImagePlug *output, const
 
 	h.append( sizePlug()->getValue() );
 	transformPlug()->hash( h );
+	h.append( ImagePlug::resolutionLevel( context ) );
 }
 
 IECore::ConstFloatVectorDataPtr Checkerboard::computeChannelData( const std::string &channelName, const Imath::V2i &tileOrigin, const Gaffer::Context *context, const ImagePlug *parent ) const
@@ -260,6 +261,11 @@ IECore::ConstFloatVectorDataPtr Checkerboard::computeChannelData( const std::str
 
 	const float valueA = colorAPlug()->getChild( channelIndex )->getValue();
 	const float valueB = colorBPlug()->getChild( channelIndex )->getValue();
+	if( valueA == valueB )
+	{
+		return ImagePlug::constantTile( valueA );
+	}
+
 	const V2f size = sizePlug()->getValue();
 	const M33f transform = transformPlug()->matrix();
 	const M33f inverseTransform = transform.inverse();
@@ -272,6 +278,12 @@ IECore::ConstFloatVectorDataPtr Checkerboard::computeChannelData( const std::str
 	inverseTransform.multDirMatrix( baseB, filterWidthB );
 	V2f filterWidth( fabs( filterWidthA.x ) + fabs( filterWidthB.x ), fabs( filterWidthA.y ) + fabs( filterWidthB.y ) );
 
+	// At reduced resolution levels, we evaluate the full resolution
+	// pattern at the centre of each reduced pixel, with a correspondingly
+	// wider filter.
+	const float resolutionScale = Format::resolutionScale( ImagePlug::resolutionLevel( context ) );
+	filterWidth /= resolutionScale;
+
 	FloatVectorDataPtr resultData = new FloatVectorData;
 	vector<float> &result = resultData->writable();
 	result.reserve( ImagePlug::tileSize() * ImagePlug::tileSize() );
@@ -285,6 +297,7 @@ IECore::ConstFloatVectorDataPtr Checkerboard::computeChannelData( const std::str
 		for( int x = 0; x < ImagePlug::tileSize(); ++x )
 		{
 			V2f p( tileOrigin.x + x + .5f, tileOrigin.y + y + .5f );
+			p /= resolutionScale;
 			p *= inverseTransform;
 
 			w0 = filteredStripes( p.x, size.x, filterWidth.x );
@@ -296,5 +309,13 @@ IECore::ConstFloatVectorDataPtr Checkerboard::computeChannelData( const std::str
 
 	}
 
+	// Tiles which lie entirely within a single square share
+	// a single tile, rather than each storing their own copy.
+	float constantValue;
+	if( ImagePlug::isConstantTile( resultData.get(), constantValue ) )
+	{
+		return ImagePlug::constantTile( constantValue );
+	}
+
 	return resultData;
 }
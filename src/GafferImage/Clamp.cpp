@@ -257,3 +257,8 @@ void Clamp::processChannelData( const Gaffer::Context *context, const ImagePlug
 
 	}
 }
+
+bool Clamp::perPixel() const
+{
+	return true;
+}
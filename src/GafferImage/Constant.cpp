@@ -190,8 +190,5 @@ IECore::ConstFloatVectorDataPtr Constant::computeChannelData( const std::string
 	const int channelIndex = ImageAlgo::colorIndex( context->get<std::string>( ImagePlug::channelNameContextName ) );
 	const float value = colorPlug()->getChild( channelIndex )->getValue();
 
-	FloatVectorDataPtr result = new FloatVectorData;
-	result->writable().resize( ImagePlug::tileSize() * ImagePlug::tileSize(), value );
-
-	return result;
+	return ImagePlug::constantTile( value );
 }
@@ -320,6 +320,7 @@ void Crop::hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context
 			default:
 			{
 				areaPlug()->hash( h );
+				h.append( ImagePlug::resolutionLevel( context ) );
 				break;
 			}
 		}
@@ -371,7 +372,7 @@ void Crop::compute( Gaffer::ValuePlug *output, const Gaffer::Context *context )
 			}
 			default:
 			{
-				cropWindow = areaPlug()->getValue();
+				cropWindow = Format::atResolutionLevel( areaPlug()->getValue(), ImagePlug::resolutionLevel( context ) );
 				break;
 			}
 		}
@@ -158,7 +158,7 @@ class GafferDisplayDriver : public IECoreImage::DisplayDriver
 					for( int channelIndex = 0, numChannels = channelNames().size(); channelIndex < numChannels; ++channelIndex )
 					{
 						const V2i tileOrigin( tileOriginX, tileOriginY );
-						ConstFloatVectorDataPtr tileData = getTile( tileOrigin, channelIndex );
+						ConstFloatVectorDataPtr tileData = getTile( tileOrigin, channelIndex ).data;
 						if( !tileData )
 						{
 							// we've been sent data outside of the data window
@@ -219,7 +219,7 @@ class GafferDisplayDriver : public IECoreImage::DisplayDriver
 				return ImagePlug::blackTile();
 			}
 
-			ConstFloatVectorDataPtr tile = getTile( tileOrigin, cIt - channelNames().begin() );
+			ConstFloatVectorDataPtr tile = getTile( tileOrigin, cIt - channelNames().begin() ).data;
 			if( tile )
 			{
 				return tile;
@@ -230,6 +230,21 @@ class GafferDisplayDriver : public IECoreImage::DisplayDriver
 			}
 		}
 
+		// Returns the hash of the data for the specified tile. This is
+		// computed once when the tile is received, rather than each time
+		// it is requested.
+		IECore::MurmurHash tileHash( const Imath::V2i &tileOrigin, const std::string &channelName )
+		{
+			vector<string>::const_iterator cIt = find( channelNames().begin(), channelNames().end(), channelName );
+			if( cIt == channelNames().end() )
+			{
+				return ImagePlug::blackTile()->Object::hash();
+			}
+
+			const Tile tile = getTile( tileOrigin, cIt - channelNames().begin() );
+			return tile.data ? tile.hash : ImagePlug::blackTile()->Object::hash();
+		}
+
 		typedef boost::signal<void ( GafferDisplayDriver *, const Imath::Box2i & )> DataReceivedSignal;
 		DataReceivedSignal &dataReceivedSignal()
 		{
@@ -251,7 +266,13 @@ class GafferDisplayDriver : public IECoreImage::DisplayDriver
 			Display::driverCreatedSignal()( driver.get(), parameters.get() );
 		}
 
-		ConstFloatVectorDataPtr getTile( const V2i &tileOrigin, size_t channelIndex )
+		struct Tile
+		{
+			ConstFloatVectorDataPtr data;
+			IECore::MurmurHash hash;
+		};
+
+		Tile getTile( const V2i &tileOrigin, size_t channelIndex )
 		{
 			V2i tileIndex = tileOrigin / ImagePlug::tileSize();
 
@@ -263,15 +284,16 @@ class GafferDisplayDriver : public IECoreImage::DisplayDriver
 			)
 			{
 				// outside data window
-				return nullptr;
+				return Tile();
 			}
 
 			tbb::spin_rw_mutex::scoped_lock tileLock( m_tileMutex, false /* read */ );
 
-			ConstFloatVectorDataPtr result = m_tiles[tileIndex.x][tileIndex.y][channelIndex];
-			if( !result )
+			Tile result = m_tiles[tileIndex.x][tileIndex.y][channelIndex];
+			if( !result.data )
 			{
-				result = ImagePlug::blackTile();
+				result.data = ImagePlug::blackTile();
+				result.hash = result.data->Object::hash();
 			}
 
 			return result;
@@ -279,13 +301,18 @@ class GafferDisplayDriver : public IECoreImage::DisplayDriver
 
 		void setTile( const V2i &tileOrigin, size_t channelIndex, ConstFloatVectorDataPtr tile )
 		{
+			// Hash outside the lock, so that we don't block readers.
+			const IECore::MurmurHash hash = tile->Object::hash();
+
 			V2i tileIndex = tileOrigin / ImagePlug::tileSize();
 			tbb::spin_rw_mutex::scoped_lock tileLock( m_tileMutex, true /* write */ );
-			m_tiles[tileIndex.x][tileIndex.y][channelIndex] = tile;
+			Tile &t = m_tiles[tileIndex.x][tileIndex.y][channelIndex];
+			t.data = tile;
+			t.hash = hash;
 		}
 
 		// indexed by tileIndexX, tileIndexY, channelIndex.
-		typedef boost::multi_array<ConstFloatVectorDataPtr, 3> TileArray;
+		typedef boost::multi_array<Tile, 3> TileArray;
 		TileArray m_tiles;
 		tbb::spin_rw_mutex m_tileMutex;
 
@@ -326,6 +353,19 @@ Display::Display( const std::string &name )
 			Plug::Default & ~Plug::Serialisable
 		)
 	);
+
+	// This plug is incremented when the driver is changed, prompting
+	// reevaluation of everything, not just the channel data.
+	addChild(
+		new IntPlug(
+			"__driverCount",
+			Plug::In,
+			0,
+			0,
+			Imath::limits<int>::max(),
+			Plug::Default & ~Plug::Serialisable
+		)
+	);
 }
 
 Display::~Display()
@@ -342,11 +382,28 @@ const Gaffer::IntPlug *Display::updateCountPlug() const
 	return getChild<IntPlug>( g_firstPlugIndex );
 }
 
+Gaffer::IntPlug *Display::driverCountPlug()
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 1 );
+}
+
+const Gaffer::IntPlug *Display::driverCountPlug() const
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 1 );
+}
+
 void Display::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const
 {
 	ImageNode::affects( input, outputs );
 
 	if( input == updateCountPlug() )
+	{
+		// Receiving data only changes the channel data, and
+		// `hashChannelData()` ensures that only the tiles which
+		// have actually received data get new hashes.
+		outputs.push_back( outPlug()->channelDataPlug() );
+	}
+	else if( input == driverCountPlug() )
 	{
 		for( ValuePlugIterator it( outPlug() ); !it.done(); ++it )
 		{
@@ -376,6 +433,7 @@ void Display::setDriver( IECoreImage::DisplayDriverPtr driver, bool copy )
 	}
 
 	setupDriver( copy ? new GafferDisplayDriver( *gafferDisplayDriver ) : gafferDisplayDriver );
+	driverCountPlug()->setValue( driverCountPlug()->getValue() + 1 );
 }
 
 IECoreImage::DisplayDriver *Display::getDriver()
@@ -470,15 +528,21 @@ IECore::ConstCompoundDataPtr Display::computeMetadata( const Gaffer::Context *co
 
 void Display::hashChannelData( const GafferImage::ImagePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
-	ConstFloatVectorDataPtr channelData = ImagePlug::blackTile();
+	// The driver hashes each tile as it is received, so we
+	// don't need to rehash the data each time we're called.
+	// Tiles not overlapped by a bucket keep their hash, as do
+	// tiles which are resent with identical data.
 	if( m_driver )
 	{
-		channelData = m_driver->channelData(
+		h = m_driver->tileHash(
 			context->get<Imath::V2i>( ImagePlug::tileOriginContextName ),
 			context->get<std::string>( ImagePlug::channelNameContextName )
 		);
 	}
-	h = channelData->Object::hash();
+	else
+	{
+		h = ImagePlug::blackTile()->Object::hash();
+	}
 }
 
 IECore::ConstFloatVectorDataPtr Display::computeChannelData( const std::string &channelName, const Imath::V2i &tileOrigin, const Gaffer::Context *context, const ImagePlug *parent ) const
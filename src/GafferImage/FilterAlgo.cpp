@@ -260,6 +260,88 @@ std::vector<FilterPair> getAllFilters()
 	return filters;
 }
 
+
+// Shared implementation of the sampleBox() overloads. Rather than fetching
+// pixels one at a time, we fetch a whole row of the filter support at once
+// using `rowAccessor( y, xBegin, xEnd, rowScratch )`, which must return a
+// pointer to the `xEnd - xBegin` values in the row, using `rowScratch` as
+// storage if necessary.
+template<typename RowAccessor>
+float sampleBoxInternal( RowAccessor &&rowAccessor, const V2f &p, float dx, float dy, const OIIO::Filter2D *filter, std::vector<float> &scratchMemory )
+{
+	float xscale = 1.0f / dx;
+	float yscale = 1.0f / dy;
+
+	Box2f bounds = filterSupport( p, dx, dy, filter->width() );
+
+	// Include any pixels where the corner max bound is above the pixel center, and
+	// the corner min bound is below the pixel center
+	Box2i pixelBounds(
+		V2i( (int)ceilf( bounds.min.x - 0.5 ), (int)ceilf( bounds.min.y - 0.5 ) ),
+		V2i( (int)floorf( bounds.max.x - 0.5 ) + 1, (int)floorf( bounds.max.y - 0.5 ) + 1 ) );
+
+	const int xWidth = pixelBounds.max.x - pixelBounds.min.x;
+	if( xWidth <= 0 )
+	{
+		return 0.0f;
+	}
+
+	// We use the scratch memory to hold a row of filter weights,
+	// followed by a row of pixel values.
+	scratchMemory.resize( xWidth * 2 );
+	float *xFilterWeights = scratchMemory.data();
+	float *rowScratch = scratchMemory.data() + xWidth;
+
+	float totalW = 0.0f;
+	float v = 0.0f;
+	if( filter->separable() )
+	{
+		for( int i = 0; i < xWidth; i++ )
+		{
+			xFilterWeights[i] = filter->xfilt( ( (pixelBounds.min.x + i) + 0.5f - p.x ) * xscale );
+		}
+
+		for( int y = pixelBounds.min.y; y < pixelBounds.max.y; y++ )
+		{
+			float yFilterWeight = filter->yfilt( ( y + 0.5f - p.y ) * yscale );
+			const float *row = rowAccessor( y, pixelBounds.min.x, pixelBounds.max.x, rowScratch );
+			for( int i = 0; i < xWidth; i++ )
+			{
+				float w = xFilterWeights[i] * yFilterWeight;
+
+				// \todo : I can't think of any way to keep this around cleanly for testing, since
+				// it's right down in this inner loop, but replacing the filter with one value for
+				// pixels within the bounding box, and another value for pixels actually touched
+				// by the filter, is a good way to check that the bounding box is correct
+				//w = w != 0.0f ? 1.0f : 0.1f;
+
+				totalW += w;
+				v += w * row[i];
+			}
+		}
+	}
+	else
+	{
+		for( int y = pixelBounds.min.y; y < pixelBounds.max.y; y++ )
+		{
+			const float *row = rowAccessor( y, pixelBounds.min.x, pixelBounds.max.x, rowScratch );
+			for( int i = 0; i < xWidth; i++ )
+			{
+				float w = (*filter)( ( pixelBounds.min.x + i + 0.5f - p.x ) * xscale, ( y + 0.5f - p.y ) * yscale );
+				totalW += w;
+				v += w * row[i];
+			}
+		}
+	}
+
+	if( totalW != 0.0f )
+	{
+		v /= totalW;
+	}
+
+	return v;
+}
+
 }
 
 const std::vector<std::string> &GafferImage::FilterAlgo::filterNames()
@@ -379,70 +461,22 @@ float GafferImage::FilterAlgo::sampleParallelogram( Sampler &sampler, const V2f
 
 float GafferImage::FilterAlgo::sampleBox( Sampler &sampler, const V2f &p, float dx, float dy, const OIIO::Filter2D *filter, std::vector<float> &scratchMemory )
 {
-	float xscale = 1.0f / dx;
-	float yscale = 1.0f / dy;
-
-	Box2f bounds = filterSupport( p, dx, dy, filter->width() );
-
-	// Include any pixels where the corner max bound is above the pixel center, and
-	// the corner min bound is below the pixel center
-	Box2i pixelBounds(
-		V2i( (int)ceilf( bounds.min.x - 0.5 ), (int)ceilf( bounds.min.y - 0.5 ) ),
-		V2i( (int)floorf( bounds.max.x - 0.5 ) + 1, (int)floorf( bounds.max.y - 0.5 ) + 1 ) );
-
-	float totalW = 0.0f;
-	float v = 0.0f;
-	if( filter->separable() )
-	{
-		int xWidth = pixelBounds.max.x - pixelBounds.min.x;
-
-		// \todo - this is an alloca call that risks blowing the stack in an edge case on overly wide image
-		// Find a more reliable alternative, hopefully without sacrificing perf
-		//float xFilterWeights[ xWidth ];
-		//std::vector<float> xFilterWeights( pixelBounds.max.x - pixelBounds.min.x );
-		//std::vector<float> xFilterWeights( xWidth );
-		scratchMemory.resize( xWidth );
-		for( int i = 0; i < xWidth; i++ )
-		{
-			// Use the scratch memory passed in to hold a row of filter weights
-			scratchMemory[i] = filter->xfilt( ( (pixelBounds.min.x + i) + 0.5f - p.x ) * xscale );
-		}
-
-		for( int y = pixelBounds.min.y; y < pixelBounds.max.y; y++ )
-		{
-			float yFilterWeight = filter->yfilt( ( y + 0.5f - p.y ) * yscale );
-			for( int x = pixelBounds.min.x; x < pixelBounds.max.x; x++ )
-			{
-				float w = scratchMemory[ x - pixelBounds.min.x ] * yFilterWeight;
-
-				// \todo : I can't think of any way to keep this around cleanly for testing, since
-				// it's right down in this inner loop, but replacing the filter with one value for
-				// pixels within the bounding box, and another value for pixels actually touched
-				// by the filter, is a good way to check that the bounding box is correct
-				//w = w != 0.0f ? 1.0f : 0.1f;
-			
-				totalW += w;
-				v += w * sampler.sample( x, y );
-			}
-		}
-	}
-	else
-	{
-		for( int y = pixelBounds.min.y; y < pixelBounds.max.y; y++ )
-		{
-			for( int x = pixelBounds.min.x; x < pixelBounds.max.x; x++ )
-			{
-				float w = (*filter)( ( x + 0.5f - p.x ) * xscale, ( y + 0.5f - p.y ) * yscale );
-				totalW += w;
-				v += w * sampler.sample( x, y );
-			}
-		}
-	}
-
-	if( totalW != 0.0f )
-	{
-		v /= totalW;
-	}
+	return sampleBoxInternal(
+		[&sampler]( int y, int xBegin, int xEnd, float *rowScratch ) {
+			sampler.sampleRow( y, xBegin, xEnd, rowScratch );
+			return static_cast<const float *>( rowScratch );
+		},
+		p, dx, dy, filter, scratchMemory
+	);
+}
 
-	return v;
+float GafferImage::FilterAlgo::sampleBox( const float *buffer, const Box2i &bufferWindow, const V2f &p, float dx, float dy, const OIIO::Filter2D *filter, std::vector<float> &scratchMemory )
+{
+	const int bufferWidth = bufferWindow.size().x;
+	return sampleBoxInternal(
+		[buffer, &bufferWindow, bufferWidth]( int y, int xBegin, int xEnd, float * ) {
+			return buffer + ( y - bufferWindow.min.y ) * bufferWidth + ( xBegin - bufferWindow.min.x );
+		},
+		p, dx, dy, filter, scratchMemory
+	);
 }
@@ -37,6 +37,7 @@
 #include "GafferImage/FormatPlug.h"
 
 #include "GafferImage/FormatData.h"
+#include "GafferImage/ImagePlug.h"
 
 #include "Gaffer/Context.h"
 #include "Gaffer/Process.h"
@@ -109,9 +110,17 @@ void FormatPlug::setValue( const Format &value )
 Format FormatPlug::getValue() const
 {
 	Format result( displayWindowPlug()->getValue(), pixelAspectPlug()->getValue() );
-	if( direction() == Plug::In && result.getDisplayWindow().isEmpty() && Process::current() )
+	if( direction() == Plug::In && Process::current() )
 	{
-		return getDefaultFormat( Context::current() );
+		const Context *context = Context::current();
+		if( result.getDisplayWindow().isEmpty() )
+		{
+			result = getDefaultFormat( context );
+		}
+		if( reducesToResolutionLevel() )
+		{
+			result = result.atResolutionLevel( ImagePlug::resolutionLevel( context ) );
+		}
 	}
 	return result;
 }
@@ -121,9 +130,14 @@ IECore::MurmurHash FormatPlug::hash() const
 	if( direction() == Plug::In )
 	{
 		Format v( displayWindowPlug()->getValue(), pixelAspectPlug()->getValue() );
+		const Context *context = Context::current();
 		if( v.getDisplayWindow().isEmpty() )
 		{
-			v = getDefaultFormat( Context::current() );
+			v = getDefaultFormat( context );
+		}
+		if( reducesToResolutionLevel() )
+		{
+			v = v.atResolutionLevel( ImagePlug::resolutionLevel( context ) );
 		}
 
 		IECore::MurmurHash result;
@@ -135,6 +149,13 @@ IECore::MurmurHash FormatPlug::hash() const
 	return ValuePlug::hash();
 }
 
+bool FormatPlug::reducesToResolutionLevel() const
+{
+	// The format of an image has already been reduced by the
+	// node that generated it, so must not be reduced again.
+	return !IECore::runTimeCast<const ImagePlug>( parent() );
+}
+
 Format FormatPlug::getDefaultFormat( const Gaffer::Context *context )
 {
 	return context->get<Format>( g_defaultFormatContextName, g_defaultFormatFallback );
@@ -249,8 +249,7 @@ void Grade::hashChannelData( const GafferImage::ImagePlug *output, const Gaffer:
 
 void Grade::processChannelData( const Gaffer::Context *context, const ImagePlug *parent, const std::string &channel, FloatVectorDataPtr outData ) const
 {
-	// Calculate the valid data window that we are to merge.
-	const int dataWidth = ImagePlug::tileSize()*ImagePlug::tileSize();
+	const size_t dataWidth = outData->readable().size();
 
 	// Do some pre-processing.
 	float A, B, gamma;
@@ -283,6 +282,11 @@ void Grade::processChannelData( const Gaffer::Context *context, const ImagePlug
 	}
 }
 
+bool Grade::perPixel() const
+{
+	return true;
+}
+
 void Grade::parameters( size_t channelIndex, float &a, float &b, float &gamma ) const
 {
 	gamma = gammaPlug()->getChild( channelIndex )->getValue();
@@ -44,6 +44,10 @@
 #include "Gaffer/Context.h"
 #include "Gaffer/ContextAlgo.h"
 
+#include "IECore/LRUCache.h"
+
+#include <cstring>
+
 using namespace std;
 using namespace tbb;
 using namespace Imath;
@@ -113,6 +117,7 @@ class CopyTile
 
 const IECore::InternedString ImagePlug::channelNameContextName = "image:channelName";
 const IECore::InternedString ImagePlug::tileOriginContextName = "image:tileOrigin";
+const IECore::InternedString ImagePlug::resolutionLevelContextName = "image:resolutionLevel";
 
 static ContextAlgo::GlobalScope::Registration g_globalScopeRegistration(
 	ImagePlug::staticTypeId(),
@@ -121,6 +126,11 @@ static ContextAlgo::GlobalScope::Registration g_globalScopeRegistration(
 
 size_t ImagePlug::g_firstPlugIndex = 0;
 
+int ImagePlug::resolutionLevel( const Gaffer::Context *context )
+{
+	return std::max( 0, context->get<int>( resolutionLevelContextName, 0 ) );
+}
+
 ImagePlug::ImagePlug( const std::string &name, Direction direction, unsigned flags )
 	:	ValuePlug( name, direction, flags )
 {
@@ -202,6 +212,77 @@ const IECore::FloatVectorData *ImagePlug::blackTile()
 	return g_blackTile.get();
 };
 
+namespace
+{
+
+// Keyed by the bit pattern of the value, so that values
+// such as -0 and NaN get tiles of their own.
+uint32_t constantTileKey( float value )
+{
+	uint32_t key;
+	std::memcpy( &key, &value, sizeof( key ) );
+	return key;
+}
+
+IECore::ConstFloatVectorDataPtr constantTileGetter( const uint32_t &key, size_t &cost )
+{
+	cost = 1;
+	float value;
+	std::memcpy( &value, &key, sizeof( value ) );
+	return new IECore::FloatVectorData( std::vector<float>( ImagePlug::tileSize() * ImagePlug::tileSize(), value ) );
+}
+
+typedef IECore::LRUCache<uint32_t, IECore::ConstFloatVectorDataPtr, IECore::LRUCachePolicy::Parallel> ConstantTileCache;
+ConstantTileCache g_constantTileCache( constantTileGetter, 1000 );
+
+} // namespace
+
+IECore::ConstFloatVectorDataPtr ImagePlug::constantTile( float value )
+{
+	const uint32_t key = constantTileKey( value );
+	if( key == constantTileKey( 0.0f ) )
+	{
+		return blackTile();
+	}
+	else if( key == constantTileKey( 1.0f ) )
+	{
+		return whiteTile();
+	}
+	return g_constantTileCache.get( key );
+}
+
+bool ImagePlug::isConstantTile( const IECore::FloatVectorData *tile, float &value )
+{
+	if( tile == blackTile() )
+	{
+		value = 0.0f;
+		return true;
+	}
+	else if( tile == whiteTile() )
+	{
+		value = 1.0f;
+		return true;
+	}
+
+	const std::vector<float> &data = tile->readable();
+	if( data.empty() )
+	{
+		return false;
+	}
+
+	const float first = data[0];
+	for( float v : data )
+	{
+		if( v != first )
+		{
+			return false;
+		}
+	}
+
+	value = first;
+	return true;
+}
+
 bool ImagePlug::acceptsChild( const GraphComponent *potentialChild ) const
 {
 	if( !ValuePlug::acceptsChild( potentialChild ) )
@@ -39,6 +39,7 @@
 #include "GafferImage/ColorSpace.h"
 #include "GafferImage/OpenImageIOReader.h"
 
+#include "Gaffer/BackgroundTask.h"
 #include "Gaffer/StringPlug.h"
 
 #include "OpenEXR/ImathFun.h"
@@ -302,6 +303,11 @@ size_t ImageReader::supportedExtensions( std::vector<std::string> &extensions )
 	return extensions.size();
 }
 
+std::unique_ptr<Gaffer::BackgroundTask> ImageReader::prefetch( const std::vector<float> &frames ) const
+{
+	return oiioReader()->prefetch( frames );
+}
+
 void ImageReader::setDefaultColorSpaceFunction( DefaultColorSpaceFunction f )
 {
 	defaultColorSpaceFunction() = f;
@@ -142,7 +142,7 @@ void ImageSampler::hash( const Gaffer::ValuePlug *output, const Gaffer::Context
 		std::string channel = channelName( output );
 		if( channel.size() )
 		{
-			V2f pixel = pixelPlug()->getValue();
+			const V2f pixel = this->pixel( context );
 			Box2i sampleWindow;
 			sampleWindow.extendBy( V2i( pixel ) - V2i( 1 ) );
 			sampleWindow.extendBy( V2i( pixel ) + V2i( 1 ) );
@@ -163,7 +163,7 @@ void ImageSampler::compute( Gaffer::ValuePlug *output, const Gaffer::Context *co
 		std::string channel = channelName( output );
 		if( channel.size() )
 		{
-			V2f pixel = pixelPlug()->getValue();
+			const V2f pixel = this->pixel( context );
 			Box2i sampleWindow;
 			sampleWindow.extendBy( V2i( pixel ) - V2i( 1 ) );
 			sampleWindow.extendBy( V2i( pixel ) + V2i( 1 ) );
@@ -178,6 +178,13 @@ void ImageSampler::compute( Gaffer::ValuePlug *output, const Gaffer::Context *co
 	ComputeNode::compute( output, context );
 }
 
+Imath::V2f ImageSampler::pixel( const Gaffer::Context *context ) const
+{
+	// The pixel is specified at full resolution, so must be scaled
+	// to match the resolution level being computed.
+	return pixelPlug()->getValue() * Format::resolutionScale( ImagePlug::resolutionLevel( context ) );
+}
+
 std::string ImageSampler::channelName( const Gaffer::ValuePlug *output ) const
 {
 	size_t index = 0;
@@ -38,13 +38,19 @@
 
 #include "GafferImage/FormatPlug.h"
 #include "GafferImage/ImageAlgo.h"
-#include "GafferImage/Sampler.h"
 
 #include "Gaffer/BoxPlug.h"
 #include "Gaffer/ScriptNode.h"
 #include "Gaffer/TypedPlug.h"
 
+#include "IECore/SimpleTypedData.h"
+#include "IECore/VectorTypedData.h"
+
+#include "OpenEXR/ImathFun.h"
+
 using namespace std;
+using namespace Imath;
+using namespace IECore;
 using namespace Gaffer;
 using namespace GafferImage;
 
@@ -55,16 +61,23 @@ using namespace GafferImage;
 namespace
 {
 
+// The area is specified at full resolution, so must be reduced to match
+// the resolution level being computed.
+Box2i area( const Box2iPlug *areaPlug, const Context *context )
+{
+	return Format::atResolutionLevel( areaPlug->getValue(), ImagePlug::resolutionLevel( context ) );
+}
+
 int colorIndex( const ValuePlug *plug )
 {
-	const Color4fPlug *colorPlug = plug->parent<Color4fPlug>();
-	if( !colorPlug )
+	const ValuePlug *parent = plug->parent<ValuePlug>();
+	if( !parent )
 	{
 		return -1;
 	}
-	for( size_t i = 0; i < 4; ++i )
+	for( size_t i = 0; i < 4 && i < parent->children().size(); ++i )
 	{
-		if( plug == colorPlug->getChild( i ) )
+		if( plug == parent->getChild( i ) )
 		{
 			return i;
 		}
@@ -72,6 +85,133 @@ int colorIndex( const ValuePlug *plug )
 	return -1;
 }
 
+const InternedString g_minName( "min" );
+const InternedString g_maxName( "max" );
+const InternedString g_sumName( "sum" );
+const InternedString g_histogramName( "histogram" );
+
+// Accumulates statistics for a set of samples. Used both to
+// compute the stats for individual tiles, and to merge the
+// stats from many tiles into one.
+struct Stats
+{
+
+	Stats( int numBins, const V2f &range )
+		:	min( Imath::limits<float>::max() ), max( Imath::limits<float>::min() ), sum( 0 ),
+			histogram( std::max( numBins, 1 ), 0 ),
+			m_rangeMin( range[0] ),
+			m_binScale( range[1] > range[0] ? histogram.size() / ( range[1] - range[0] ) : 0.0f )
+	{
+	}
+
+	void addSample( float v )
+	{
+		min = std::min( v, min );
+		max = std::max( v, max );
+		sum += v;
+		histogram[binIndex(v)]++;
+	}
+
+	// Adds `count` samples of value `v`.
+	void addSamples( float v, int count )
+	{
+		if( !count )
+		{
+			return;
+		}
+		min = std::min( v, min );
+		max = std::max( v, max );
+		sum += (double)v * count;
+		histogram[binIndex(v)] += count;
+	}
+
+	void addStats( const CompoundObject *stats )
+	{
+		min = std::min( stats->member<FloatData>( g_minName )->readable(), min );
+		max = std::max( stats->member<FloatData>( g_maxName )->readable(), max );
+		sum += stats->member<DoubleData>( g_sumName )->readable();
+		const vector<int> &h = stats->member<IntVectorData>( g_histogramName )->readable();
+		for( size_t i = 0, e = std::min( h.size(), histogram.size() ); i < e; ++i )
+		{
+			histogram[i] += h[i];
+		}
+	}
+
+	CompoundObjectPtr toCompoundObject()
+	{
+		CompoundObjectPtr result = new CompoundObject;
+		result->members()[g_minName] = new FloatData( min );
+		result->members()[g_maxName] = new FloatData( max );
+		result->members()[g_sumName] = new DoubleData( sum );
+		IntVectorDataPtr histogramData = new IntVectorData;
+		histogramData->writable().swap( histogram );
+		result->members()[g_histogramName] = histogramData;
+		return result;
+	}
+
+	float min;
+	float max;
+	double sum;
+	vector<int> histogram;
+
+	private :
+
+		size_t binIndex( float v ) const
+		{
+			// Written so that NaNs fall into the first bin.
+			const float f = ( v - m_rangeMin ) * m_binScale;
+			if( f > 0 )
+			{
+				return f < histogram.size() ? (size_t)f : histogram.size() - 1;
+			}
+			return 0;
+		}
+
+		const float m_rangeMin;
+		const float m_binScale;
+
+};
+
+// Estimates the value below which `percentile` percent
+// of the samples fall, by interpolating within the
+// histogram bin containing that rank.
+float percentileValue( const CompoundObject *stats, float percentile, const V2f &range )
+{
+	const float min = stats->member<FloatData>( g_minName )->readable();
+	const float max = stats->member<FloatData>( g_maxName )->readable();
+	if( percentile <= 0.0f )
+	{
+		return min;
+	}
+	else if( percentile >= 100.0f )
+	{
+		return max;
+	}
+
+	const vector<int> &histogram = stats->member<IntVectorData>( g_histogramName )->readable();
+	double total = 0;
+	for( auto c : histogram )
+	{
+		total += c;
+	}
+
+	const double rank = total * percentile / 100.0;
+	const double binWidth = ( range[1] - range[0] ) / histogram.size();
+	double cumulative = 0;
+	for( size_t i = 0; i < histogram.size(); ++i )
+	{
+		if( !histogram[i] || cumulative + histogram[i] < rank )
+		{
+			cumulative += histogram[i];
+			continue;
+		}
+		const double v = range[0] + binWidth * ( i + ( rank - cumulative ) / histogram[i] );
+		return Imath::clamp( (float)v, min, max );
+	}
+
+	return max;
+}
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////
@@ -97,9 +237,24 @@ ImageStats::ImageStats( const std::string &name )
 	addChild( new StringVectorDataPlug( "channels", Plug::In, defaultChannelsData ) );
 
 	addChild( new Box2iPlug( "area", Gaffer::Plug::In ) );
+	addChild( new IntPlug( "histogramBins", Gaffer::Plug::In, 256, 1 ) );
+	addChild( new V2fPlug( "histogramRange", Gaffer::Plug::In, V2f( 0, 1 ) ) );
+	addChild( new FloatPlug( "percentile", Gaffer::Plug::In, 50, 0, 100 ) );
 	addChild( new Color4fPlug( "average", Gaffer::Plug::Out, Imath::Color4f( 0, 0, 0, 1 ) ) );
 	addChild( new Color4fPlug( "min", Gaffer::Plug::Out, Imath::Color4f( 0, 0, 0, 1 ) ) );
 	addChild( new Color4fPlug( "max", Gaffer::Plug::Out, Imath::Color4f( 0, 0, 0, 1 ) ) );
+
+	ValuePlugPtr histogramPlug = new ValuePlug( "histogram", Gaffer::Plug::Out );
+	const char *componentNames[] = { "r", "g", "b", "a" };
+	for( auto componentName : componentNames )
+	{
+		histogramPlug->addChild( new IntVectorDataPlug( componentName, Gaffer::Plug::Out, new IntVectorData ) );
+	}
+	addChild( histogramPlug );
+
+	addChild( new Color4fPlug( "percentileValue", Gaffer::Plug::Out, Imath::Color4f( 0, 0, 0, 1 ) ) );
+	addChild( new CompoundObjectPlug( "__tileStats", Gaffer::Plug::Out, new CompoundObject ) );
+	addChild( new CompoundObjectPlug( "__allStats", Gaffer::Plug::Out, new CompoundObject ) );
 }
 
 ImageStats::~ImageStats()
@@ -136,43 +291,133 @@ const Box2iPlug *ImageStats::areaPlug() const
 	return getChild<Box2iPlug>( g_firstPlugIndex + 2 );
 }
 
+IntPlug *ImageStats::histogramBinsPlug()
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 3 );
+}
+
+const IntPlug *ImageStats::histogramBinsPlug() const
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 3 );
+}
+
+V2fPlug *ImageStats::histogramRangePlug()
+{
+	return getChild<V2fPlug>( g_firstPlugIndex + 4 );
+}
+
+const V2fPlug *ImageStats::histogramRangePlug() const
+{
+	return getChild<V2fPlug>( g_firstPlugIndex + 4 );
+}
+
+FloatPlug *ImageStats::percentilePlug()
+{
+	return getChild<FloatPlug>( g_firstPlugIndex + 5 );
+}
+
+const FloatPlug *ImageStats::percentilePlug() const
+{
+	return getChild<FloatPlug>( g_firstPlugIndex + 5 );
+}
+
 Color4fPlug *ImageStats::averagePlug()
 {
-	return getChild<Color4fPlug>( g_firstPlugIndex + 3 );
+	return getChild<Color4fPlug>( g_firstPlugIndex + 6 );
 }
 
 const Color4fPlug *ImageStats::averagePlug() const
 {
-	return getChild<Color4fPlug>( g_firstPlugIndex + 3 );
+	return getChild<Color4fPlug>( g_firstPlugIndex + 6 );
 }
 
 Color4fPlug *ImageStats::minPlug()
 {
-	return getChild<Color4fPlug>( g_firstPlugIndex + 4 );
+	return getChild<Color4fPlug>( g_firstPlugIndex + 7 );
 }
 
 const Color4fPlug *ImageStats::minPlug() const
 {
-	return getChild<Color4fPlug>( g_firstPlugIndex + 4 );
+	return getChild<Color4fPlug>( g_firstPlugIndex + 7 );
 }
 
 Color4fPlug *ImageStats::maxPlug()
 {
-	return getChild<Color4fPlug>( g_firstPlugIndex + 5 );
+	return getChild<Color4fPlug>( g_firstPlugIndex + 8 );
 }
 
 const Color4fPlug *ImageStats::maxPlug() const
 {
-	return getChild<Color4fPlug>( g_firstPlugIndex + 5 );
+	return getChild<Color4fPlug>( g_firstPlugIndex + 8 );
+}
+
+ValuePlug *ImageStats::histogramPlug()
+{
+	return getChild<ValuePlug>( g_firstPlugIndex + 9 );
+}
+
+const ValuePlug *ImageStats::histogramPlug() const
+{
+	return getChild<ValuePlug>( g_firstPlugIndex + 9 );
+}
+
+Color4fPlug *ImageStats::percentileValuePlug()
+{
+	return getChild<Color4fPlug>( g_firstPlugIndex + 10 );
+}
+
+const Color4fPlug *ImageStats::percentileValuePlug() const
+{
+	return getChild<Color4fPlug>( g_firstPlugIndex + 10 );
+}
+
+CompoundObjectPlug *ImageStats::tileStatsPlug()
+{
+	return getChild<CompoundObjectPlug>( g_firstPlugIndex + 11 );
+}
+
+const CompoundObjectPlug *ImageStats::tileStatsPlug() const
+{
+	return getChild<CompoundObjectPlug>( g_firstPlugIndex + 11 );
+}
+
+CompoundObjectPlug *ImageStats::allStatsPlug()
+{
+	return getChild<CompoundObjectPlug>( g_firstPlugIndex + 12 );
+}
+
+const CompoundObjectPlug *ImageStats::allStatsPlug() const
+{
+	return getChild<CompoundObjectPlug>( g_firstPlugIndex + 12 );
 }
 
 void ImageStats::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const
 {
 	ComputeNode::affects( input, outputs );
+
 	if(
 		input == inPlug()->dataWindowPlug() ||
-		input == inPlug()->channelNamesPlug() ||
 		input == inPlug()->channelDataPlug() ||
+		input == histogramBinsPlug() ||
+		histogramRangePlug()->isAncestorOf( input ) ||
+		areaPlug()->isAncestorOf( input )
+	)
+	{
+		outputs.push_back( tileStatsPlug() );
+	}
+
+	if(
+		input == tileStatsPlug() ||
+		input == inPlug()->dataWindowPlug() ||
+		areaPlug()->isAncestorOf( input )
+	)
+	{
+		outputs.push_back( allStatsPlug() );
+	}
+
+	if(
+		input == allStatsPlug() ||
+		input == inPlug()->channelNamesPlug() ||
 		input == channelsPlug() ||
 		areaPlug()->isAncestorOf( input )
 	)
@@ -182,15 +427,71 @@ void ImageStats::affects( const Gaffer::Plug *input, AffectedPlugsContainer &out
 			outputs.push_back( minPlug()->getChild(i) );
 			outputs.push_back( averagePlug()->getChild(i) );
 			outputs.push_back( maxPlug()->getChild(i) );
+			outputs.push_back( histogramPlug()->getChild<ValuePlug>( i ) );
+			outputs.push_back( percentileValuePlug()->getChild(i) );
 		}
 		return;
 	}
+
+	if( input == percentilePlug() || histogramRangePlug()->isAncestorOf( input ) )
+	{
+		for( unsigned int i = 0; i < 4; ++i )
+		{
+			outputs.push_back( percentileValuePlug()->getChild(i) );
+		}
+	}
 }
 
 void ImageStats::hash( const ValuePlug *output, const Context *context, IECore::MurmurHash &h ) const
 {
 	ComputeNode::hash( output, context, h);
 
+	if( output == tileStatsPlug() )
+	{
+		const V2i tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
+		const Box2i tileWindow = BufferAlgo::intersection(
+			statsWindow( context ),
+			Box2i( tileOrigin, tileOrigin + V2i( ImagePlug::tileSize() ) )
+		);
+		inPlug()->channelDataPlug()->hash( h );
+		// We hash the window relative to the tile origin, so that tiles which are
+		// entirely inside the area have identical hashes however the area moves.
+		h.append( Box2i( tileWindow.min - tileOrigin, tileWindow.max - tileOrigin ) );
+		histogramBinsPlug()->hash( h );
+		histogramRangePlug()->hash( h );
+		return;
+	}
+	else if( output == allStatsPlug() )
+	{
+		const Box2i area = ::area( areaPlug(), context );
+		const Box2i statsWindow = this->statsWindow( context );
+		h.append( area.size() );
+		h.append( statsWindow.size() );
+		histogramBinsPlug()->hash( h );
+		histogramRangePlug()->hash( h );
+		if( BufferAlgo::empty( statsWindow ) )
+		{
+			return;
+		}
+
+		ImageAlgo::parallelGatherTiles(
+			inPlug(),
+			// Tile
+			[ this ] ( const ImagePlug *imagePlug, const V2i &tileOrigin )
+			{
+				return tileStatsPlug()->hash();
+			},
+			// Gather
+			[ &h ] ( const ImagePlug *imagePlug, const V2i &tileOrigin, const IECore::MurmurHash &tileHash )
+			{
+				h.append( tileHash );
+			},
+			statsWindow,
+			ImageAlgo::TopToBottom
+		);
+		return;
+	}
+
 	const int colorIndex = ::colorIndex( output );
 	if( colorIndex == -1 )
 	{
@@ -198,21 +499,97 @@ void ImageStats::hash( const ValuePlug *output, const Context *context, IECore::
 		return;
 	}
 
+	ImagePlug::GlobalScope globalScope( context );
 	const std::string channelName = this->channelName( colorIndex );
-	const Imath::Box2i area = areaPlug()->getValue();
+	const Imath::Box2i area = ::area( areaPlug(), context );
 
 	if( channelName.empty() || BufferAlgo::empty( area ) )
 	{
-		h.append( static_cast<const FloatPlug *>( output )->defaultValue() );
+		if( output->parent<Plug>() == histogramPlug() )
+		{
+			static_cast<const IntVectorDataPlug *>( output )->defaultValue()->hash( h );
+		}
+		else
+		{
+			h.append( static_cast<const FloatPlug *>( output )->defaultValue() );
+		}
 		return;
 	}
 
-	Sampler s( inPlug(), channelName, area );
-	s.hash( h );
+	if( output->parent<Plug>() == percentileValuePlug() )
+	{
+		percentilePlug()->hash( h );
+		histogramRangePlug()->hash( h );
+	}
+
+	globalScope.set( ImagePlug::channelNameContextName, channelName );
+	allStatsPlug()->hash( h );
 }
 
 void ImageStats::compute( ValuePlug *output, const Context *context ) const
 {
+	if( output == tileStatsPlug() )
+	{
+		const V2i tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
+		const Box2i tileBound( tileOrigin, tileOrigin + V2i( ImagePlug::tileSize() ) );
+		const Box2i tileWindow = BufferAlgo::intersection( statsWindow( context ), tileBound );
+
+		Stats stats( histogramBinsPlug()->getValue(), histogramRangePlug()->getValue() );
+		if( !BufferAlgo::empty( tileWindow ) )
+		{
+			ConstFloatVectorDataPtr channelData = inPlug()->channelDataPlug()->getValue();
+			const vector<float> &channel = channelData->readable();
+			for( int y = tileWindow.min.y; y < tileWindow.max.y; ++y )
+			{
+				const float *v = &channel[BufferAlgo::index( V2i( tileWindow.min.x, y ), tileBound )];
+				for( int x = tileWindow.min.x; x < tileWindow.max.x; ++x )
+				{
+					stats.addSample( *v++ );
+				}
+			}
+		}
+
+		static_cast<CompoundObjectPlug *>( output )->setValue( stats.toCompoundObject() );
+		return;
+	}
+	else if( output == allStatsPlug() )
+	{
+		const Box2i area = ::area( areaPlug(), context );
+		const Box2i statsWindow = this->statsWindow( context );
+
+		Stats stats( histogramBinsPlug()->getValue(), histogramRangePlug()->getValue() );
+		if( !BufferAlgo::empty( statsWindow ) )
+		{
+			ImageAlgo::parallelGatherTiles(
+				inPlug(),
+				// Tile
+				[ this ] ( const ImagePlug *imagePlug, const V2i &tileOrigin )
+				{
+					return tileStatsPlug()->getValue();
+				},
+				// Gather
+				[ &stats ] ( const ImagePlug *imagePlug, const V2i &tileOrigin, const ConstCompoundObjectPtr &tileStats )
+				{
+					stats.addStats( tileStats.get() );
+				},
+				statsWindow,
+				// Floating point sums depend on the order of
+				// accumulation, so we must gather in a fixed order
+				// to give the same result for the same hash.
+				ImageAlgo::TopToBottom
+			);
+		}
+
+		// Pixels outside the data window have a value of 0.
+		const int numOutsidePixels = area.size().x * area.size().y - (
+			BufferAlgo::empty( statsWindow ) ? 0 : statsWindow.size().x * statsWindow.size().y
+		);
+		stats.addSamples( 0.0f, numOutsidePixels );
+
+		static_cast<CompoundObjectPlug *>( output )->setValue( stats.toCompoundObject() );
+		return;
+	}
+
 	const int colorIndex = ::colorIndex( output );
 	if( colorIndex == -1 )
 	{
@@ -221,8 +598,9 @@ void ImageStats::compute( ValuePlug *output, const Context *context ) const
 		return;
 	}
 
+	ImagePlug::GlobalScope globalScope( context );
 	const std::string channelName = this->channelName( colorIndex );
-	const Imath::Box2i area = areaPlug()->getValue();
+	const Imath::Box2i area = ::area( areaPlug(), context );
 
 	if( channelName.empty() || BufferAlgo::empty( area ) )
 	{
@@ -230,36 +608,34 @@ void ImageStats::compute( ValuePlug *output, const Context *context ) const
 		return;
 	}
 
-	// Loop over the ROI and compute the min, max and average channel values and then set our outputs.
-	Sampler s( inPlug(), channelName, area );
+	const float percentile = percentilePlug()->getValue();
+	const V2f histogramRange = histogramRangePlug()->getValue();
 
-	float min = Imath::limits<float>::max();
-	float max = Imath::limits<float>::min();
-	double sum = 0.;
-
-	for( int y = area.min.y; y < area.max.y; ++y )
-	{
-		for( int x = area.min.x; x < area.max.x; ++x )
-		{
-			float v = s.sample( x, y );
-			min = std::min( v, min );
-			max = std::max( v, max );
-			sum += v;
-		}
-	}
+	globalScope.set( ImagePlug::channelNameContextName, channelName );
+	ConstCompoundObjectPtr stats = allStatsPlug()->getValue();
 
 	if( output->parent<Plug>() == minPlug() )
 	{
-		static_cast<FloatPlug *>( output )->setValue( min );
+		static_cast<FloatPlug *>( output )->setValue( stats->member<FloatData>( g_minName )->readable() );
 	}
 	else if( output->parent<Plug>() == maxPlug() )
 	{
-		static_cast<FloatPlug *>( output )->setValue( max );
+		static_cast<FloatPlug *>( output )->setValue( stats->member<FloatData>( g_maxName )->readable() );
 	}
 	else if( output->parent<Plug>() == averagePlug() )
 	{
 		static_cast<FloatPlug *>( output )->setValue(
-			sum / double( (area.size().x) * (area.size().y) )
+			stats->member<DoubleData>( g_sumName )->readable() / double( (area.size().x) * (area.size().y) )
+		);
+	}
+	else if( output->parent<Plug>() == histogramPlug() )
+	{
+		static_cast<IntVectorDataPlug *>( output )->setValue( stats->member<IntVectorData>( g_histogramName ) );
+	}
+	else if( output->parent<Plug>() == percentileValuePlug() )
+	{
+		static_cast<FloatPlug *>( output )->setValue(
+			::percentileValue( stats.get(), percentile, histogramRange )
 		);
 	}
 }
@@ -282,3 +658,12 @@ std::string ImageStats::channelName( int colorIndex ) const
 
 	return "";
 }
+
+Imath::Box2i ImageStats::statsWindow( const Gaffer::Context *context ) const
+{
+	ImagePlug::GlobalScope globalScope( context );
+	return BufferAlgo::intersection(
+		::area( areaPlug(), context ),
+		inPlug()->dataWindowPlug()->getValue()
+	);
+}
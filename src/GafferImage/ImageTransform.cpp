@@ -219,6 +219,7 @@ void ImageTransform::hash( const ValuePlug *output, const Context *context, IECo
 		transformPlug()->translatePlug()->hash( h );
 		transformPlug()->scalePlug()->hash( h );
 		transformPlug()->pivotPlug()->hash( h );
+		h.append( ImagePlug::resolutionLevel( context ) );
 	}
 }
 
@@ -344,8 +345,11 @@ unsigned ImageTransform::operation( Imath::M33f &matrix, Imath::M33f &resampleMa
 {
 	const Transform2DPlug *plug = transformPlug();
 
-	const V2f pivot = plug->pivotPlug()->getValue();
-	const V2f translate = plug->translatePlug()->getValue();
+	// Pivot and translation are specified in full resolution pixels,
+	// so must be scaled to match reduced resolution levels.
+	const float resolutionScale = Format::resolutionScale( ImagePlug::resolutionLevel( Context::current() ) );
+	const V2f pivot = plug->pivotPlug()->getValue() * resolutionScale;
+	const V2f translate = plug->translatePlug()->getValue() * resolutionScale;
 	const V2f scale = plug->scalePlug()->getValue();
 	const float rotate = plug->rotatePlug()->getValue();
 
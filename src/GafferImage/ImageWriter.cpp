@@ -59,7 +59,13 @@
 
 #include "tbb/spin_mutex.h"
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <thread>
 
 #include <sys/utsname.h>
 #include <zlib.h>
@@ -127,6 +133,125 @@ class TileProcessor
 		}
 };
 
+class BackgroundWriter
+{
+	// OpenImageIO encodes and compresses the data passed to `write_scanlines()`
+	// and `write_tiles()` before returning, which can take considerable time for
+	// files with many channels. If we performed the writes directly from the
+	// serial gather stage of `parallelGatherTiles()`, the computation of subsequent
+	// tiles would stall waiting for them. Instead, the gather stage submits writes
+	// to this class, which performs them in order on a dedicated thread, so that
+	// writing overlaps with the computation of subsequent tiles.
+	//
+	// The number of pending writes is limited to `maxPendingWrites`, with `submit()`
+	// blocking until there is space in the queue. This bounds the memory used to
+	// hold data waiting to be written.
+	//
+	// We use a dedicated thread rather than a TBB task so that progress is
+	// guaranteed even when TBB is limited to a single thread, and so that we
+	// don't occupy a TBB worker while waiting for work.
+	public :
+
+		typedef std::function<void ()> Write;
+
+		BackgroundWriter( size_t maxPendingWrites )
+			:	m_maxPendingWrites( maxPendingWrites ), m_writing( false ), m_stopping( false ),
+				m_thread( &BackgroundWriter::run, this )
+		{
+		}
+
+		~BackgroundWriter()
+		{
+			{
+				std::unique_lock<std::mutex> lock( m_mutex );
+				m_stopping = true;
+				m_pendingWrites.clear();
+			}
+			m_condition.notify_all();
+			m_thread.join();
+		}
+
+		void submit( Write &&write )
+		{
+			std::unique_lock<std::mutex> lock( m_mutex );
+			m_condition.wait( lock, [this] { return m_pendingWrites.size() < m_maxPendingWrites || m_exception; } );
+			rethrowException();
+			m_pendingWrites.push_back( std::move( write ) );
+			m_condition.notify_all();
+		}
+
+		// Waits for all submitted writes to complete, rethrowing
+		// any exception thrown by them.
+		void wait()
+		{
+			std::unique_lock<std::mutex> lock( m_mutex );
+			m_condition.wait( lock, [this] { return ( m_pendingWrites.empty() && !m_writing ) || m_exception; } );
+			rethrowException();
+		}
+
+	private :
+
+		void run()
+		{
+			std::unique_lock<std::mutex> lock( m_mutex );
+			while( true )
+			{
+				m_condition.wait( lock, [this] { return !m_pendingWrites.empty() || m_stopping; } );
+				if( m_stopping )
+				{
+					return;
+				}
+
+				Write write = std::move( m_pendingWrites.front() );
+				m_pendingWrites.pop_front();
+				m_writing = true;
+				lock.unlock();
+				m_condition.notify_all();
+
+				std::exception_ptr exception;
+				try
+				{
+					write();
+				}
+				catch( ... )
+				{
+					exception = std::current_exception();
+				}
+
+				lock.lock();
+				m_writing = false;
+				if( exception )
+				{
+					// Subsequent writes would leave the file in an
+					// inconsistent state, so we discard them.
+					m_exception = exception;
+					m_pendingWrites.clear();
+				}
+				m_condition.notify_all();
+			}
+		}
+
+		void rethrowException()
+		{
+			if( m_exception )
+			{
+				std::rethrow_exception( m_exception );
+			}
+		}
+
+		const size_t m_maxPendingWrites;
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		std::deque<Write> m_pendingWrites;
+		bool m_writing;
+		bool m_stopping;
+		std::exception_ptr m_exception;
+		// Must be declared last, so that it is constructed after all
+		// the members used by `run()`.
+		std::thread m_thread;
+
+};
+
 class FlatTileWriter
 {
 	// This class is created to be used by parallelGatherTiles, and called in
@@ -170,6 +295,10 @@ class FlatTileWriter
 	// black, which is what we want. So iterate over the remaining tiles, and
 	// if memory has been allocated for that tile, write it to the file, and if
 	// nothing has been allocated, write a black tile.
+	//
+	// The writes themselves are performed asynchronously by a BackgroundWriter,
+	// so that encoding the tiles overlaps with the computation of subsequent
+	// tiles.
 	public:
 		FlatTileWriter(
 				ImageOutputPtr out,
@@ -186,7 +315,8 @@ class FlatTileWriter
 				m_outputDataWindow( m_format.fromEXRSpace( Imath::Box2i( Imath::V2i( m_spec.x, m_spec.y ), Imath::V2i( m_spec.x + m_spec.width - 1, m_spec.y + m_spec.height - 1 ) ) ) ),
 				m_numTiles( Imath::V2i( (int)ceil( float( m_spec.width ) / m_spec.tile_width ), (int)ceil( float( m_spec.height ) / m_spec.tile_height ) ) ),
 				m_nextTileIndex( 0 ),
-				m_blackTile( nullptr )
+				m_blackTile( nullptr ),
+				m_backgroundWriter( std::max( m_numTiles.x, 1 ) )
 		{
 			m_tilesData.resize( m_numTiles.x * m_numTiles.y );
 			m_tilesFilled.resize( m_numTiles.x * m_numTiles.y, false );
@@ -214,6 +344,8 @@ class FlatTileWriter
 					writeTile( tileOrigin, blackTile() );
 				}
 			}
+
+			m_backgroundWriter.wait();
 		}
 
 		void operator()( const ImagePlug *imagePlug, const string &channelName, const V2i &tileOrigin, ConstFloatVectorDataPtr data )
@@ -350,14 +482,22 @@ class FlatTileWriter
 		}
 
 
-		void writeTile( const Imath::V2i &tileOrigin, ConstFloatVectorDataPtr tileData ) const
+		void writeTile( const Imath::V2i &tileOrigin, ConstFloatVectorDataPtr tileData )
 		{
-			Imath::V2i exrTileOrigin = m_format.toEXRSpace( tileOrigin + Imath::V2i( 0, m_spec.tile_height - 1 ) );
-
-			if( !m_out->write_tile( exrTileOrigin.x, exrTileOrigin.y, 0, TypeDesc::FLOAT, &tileData->readable()[0] ) )
-			{
-				throw IECore::Exception( boost::str( boost::format( "Could not write tile to \"%s\", error = %s" ) % m_fileName % m_out->geterror() ) );
-			}
+			const Imath::V2i exrTileOrigin = m_format.toEXRSpace( tileOrigin + Imath::V2i( 0, m_spec.tile_height - 1 ) );
+
+			// Note that `tileData` is never modified after being passed to us,
+			// so it is safe for the background thread to read from it.
+			ImageOutputPtr out = m_out;
+			const std::string fileName = m_fileName;
+			m_backgroundWriter.submit(
+				[out, fileName, exrTileOrigin, tileData] {
+					if( !out->write_tile( exrTileOrigin.x, exrTileOrigin.y, 0, TypeDesc::FLOAT, &tileData->readable()[0] ) )
+					{
+						throw IECore::Exception( boost::str( boost::format( "Could not write tile to \"%s\", error = %s" ) % fileName % out->geterror() ) );
+					}
+				}
+			);
 		}
 
 		ImageOutputPtr m_out;
@@ -372,6 +512,9 @@ class FlatTileWriter
 		std::vector<FloatVectorDataPtr> m_tilesData;
 		std::vector<bool> m_tilesFilled;
 		ConstFloatVectorDataPtr m_blackTile;
+		// Declared last, so that it is destroyed first, waiting
+		// for any writes still in progress.
+		BackgroundWriter m_backgroundWriter;
 };
 
 class FlatScanlineWriter
@@ -386,8 +529,10 @@ class FlatScanlineWriter
 	// It stores a vector of floats big enough to hold ImagePlug::tileSize()
 	// scanlines. As it receives each tile, it copies the data into the
 	// appropriate location in the buffer. When it's copied the last channel
-	// of the last tile of each row, it writes all of the data from the buffer
-	// into the ImageOutput object.
+	// of the last tile of each row, it submits the buffer to a BackgroundWriter
+	// to be written to the ImageOutput object, and starts filling a new buffer
+	// with the next row. This allows the encoding of each row to overlap with
+	// the computation of the next.
 	public:
 		FlatScanlineWriter(
 				ImageOutputPtr out,
@@ -400,26 +545,27 @@ class FlatScanlineWriter
 				m_format( format ),
 				m_spec( m_out->spec() ),
 				m_processWindow( processWindow ),
-				m_tilesBounds( Imath::Box2i( ImagePlug::tileOrigin( processWindow.min ), ImagePlug::tileOrigin( processWindow.max - Imath::V2i( 1 ) ) + Imath::V2i( ImagePlug::tileSize() ) ) )
+				m_tilesBounds( Imath::Box2i( ImagePlug::tileOrigin( processWindow.min ), ImagePlug::tileOrigin( processWindow.max - Imath::V2i( 1 ) ) + Imath::V2i( ImagePlug::tileSize() ) ) ),
+				// One row may be waiting while another is written and
+				// a third is filled, which bounds the memory we use.
+				m_backgroundWriter( 1 )
 		{
-			m_scanlinesData.resize( m_spec.width * ImagePlug::tileSize() * m_spec.channelnames.size(), 0.0 );
-
 			writeInitialBlankScanlines();
 		}
 
 		void finish()
 		{
-			if( BufferAlgo::empty( m_processWindow ) )
+			// If the source data window is empty, we handle everything during construct
+			if( !BufferAlgo::empty( m_processWindow ) )
 			{
-				// If the source data window is empty, we handle everything during construct
-				return;
+				const int scanlinesEnd = m_format.toEXRSpace( m_tilesBounds.min.y - 1 );
+				if( scanlinesEnd < ( m_spec.y + m_spec.height ) )
+				{
+					writeBlankScanlines( scanlinesEnd, m_spec.y + m_spec.height );
+				}
 			}
 
-			const int scanlinesEnd = m_format.toEXRSpace( m_tilesBounds.min.y - 1 );
-			if( scanlinesEnd < ( m_spec.y + m_spec.height ) )
-			{
-				writeBlankScanlines( scanlinesEnd, m_spec.y + m_spec.height );
-			}
+			m_backgroundWriter.wait();
 		}
 
 		void operator()( const ImagePlug *imagePlug, const string &channelName, const V2i &tileOrigin, ConstFloatVectorDataPtr data )
@@ -434,20 +580,24 @@ class FlatScanlineWriter
 
 			if( firstTileOfRow( channelIndex, tileOrigin ) )
 			{
-				std::fill( m_scanlinesData.begin(), m_scanlinesData.end(), 0.0 );
+				// The previous buffer is owned by the BackgroundWriter
+				// now, so we start a new one.
+				m_scanlinesData = newScanlines();
 			}
 
 			Imath::Box2i copyArea( BufferAlgo::intersection( m_processWindow, BufferAlgo::intersection( inTileBounds, scanlinesBounds ) ) );
 
-			copyBufferArea( &data->readable()[0], inTileBounds, &m_scanlinesData[0], scanlinesBounds, channelIndex, m_spec.channelnames.size(), true, copyArea );
+			copyBufferArea( &data->readable()[0], inTileBounds, m_scanlinesData->data(), scanlinesBounds, channelIndex, m_spec.channelnames.size(), true, copyArea );
 
 			if( lastTileOfRow( channelIndex, tileOrigin ) )
 			{
 				writeScanlines(
+					m_scanlinesData,
 					std::max( exrInTileBounds.min.y, m_spec.y ),
 					std::min( exrInTileBounds.max.y + 1, m_spec.y + m_spec.height ),
 					std::max( m_spec.y - exrInTileBounds.min.y, 0 )
 				);
+				m_scanlinesData.reset();
 			}
 		}
 
@@ -463,22 +613,37 @@ class FlatScanlineWriter
 			return channelIndex == ( m_spec.channelnames.size() - 1 ) && tileOrigin.x == ( m_tilesBounds.max.x - ImagePlug::tileSize() ) ;
 		}
 
-		void writeScanlines( const int exrYBegin, const int exrYEnd, const int scanlinesYOffset = 0 ) const
+		typedef std::shared_ptr<vector<float>> ScanlinesPtr;
+
+		ScanlinesPtr newScanlines() const
 		{
-			if ( !m_out->write_scanlines( exrYBegin, exrYEnd, 0, TypeDesc::FLOAT, &m_scanlinesData[0] + ( scanlinesYOffset * m_spec.width * m_spec.channelnames.size() ) ) )
-			{
-				throw IECore::Exception( boost::str( boost::format( "Could not write scanline to \"%s\", error = %s" ) % m_fileName % m_out->geterror() ) );
-			}
+			return std::make_shared<vector<float>>( m_spec.width * ImagePlug::tileSize() * m_spec.channelnames.size(), 0.0f );
+		}
+
+		void writeScanlines( const ScanlinesPtr &scanlines, const int exrYBegin, const int exrYEnd, const int scanlinesYOffset = 0 )
+		{
+			ImageOutputPtr out = m_out;
+			const std::string fileName = m_fileName;
+			const size_t offset = scanlinesYOffset * m_spec.width * m_spec.channelnames.size();
+			m_backgroundWriter.submit(
+				[out, fileName, scanlines, exrYBegin, exrYEnd, offset] {
+					if ( !out->write_scanlines( exrYBegin, exrYEnd, 0, TypeDesc::FLOAT, scanlines->data() + offset ) )
+					{
+						throw IECore::Exception( boost::str( boost::format( "Could not write scanline to \"%s\", error = %s" ) % fileName % out->geterror() ) );
+					}
+				}
+			);
 		}
 
 		void writeBlankScanlines( int yBegin, int yEnd )
 		{
-			float *scanlines = &m_scanlinesData[0];
-			memset( scanlines, 0, sizeof(float) * m_spec.width * std::min( ImagePlug::tileSize(), yEnd - yBegin ) * m_spec.channelnames.size() );
+			// We are never going to modify this buffer, so can
+			// share it between all the writes.
+			const ScanlinesPtr scanlines = newScanlines();
 			while( yBegin < yEnd )
 			{
 				const int numLines = std::min( yEnd - yBegin, ImagePlug::tileSize() );
-				writeScanlines( yBegin, yBegin + numLines );
+				writeScanlines( scanlines, yBegin, yBegin + numLines );
 				yBegin += numLines;
 			}
 		}
@@ -506,7 +671,10 @@ class FlatScanlineWriter
 		const ImageSpec m_spec;
 		const Imath::Box2i &m_processWindow;
 		const Imath::Box2i m_tilesBounds;
-		vector<float> m_scanlinesData;
+		ScanlinesPtr m_scanlinesData;
+		// Declared last, so that it is destroyed first, waiting
+		// for any writes still in progress.
+		BackgroundWriter m_backgroundWriter;
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -725,6 +893,8 @@ ImageWriter::ImageWriter( const std::string &name )
 	addChild( new ImagePlug( "out", Plug::Out, Plug::Default & ~Plug::Serialisable ) );
 	outPlug()->setInput( inPlug() );
 
+	addFrameConcurrencyPlug();
+
 	ColorSpacePtr colorSpaceChild = new ColorSpace( "__colorSpace" );
 	addChild( colorSpaceChild );
 
@@ -965,6 +1135,20 @@ IECore::MurmurHash ImageWriter::hash( const Context *context ) const
 	return h;
 }
 
+bool ImageWriter::canExecuteFramesConcurrently() const
+{
+	// Concurrent frames are only safe if each one is written to a
+	// separate file. Rather than inspect the file name for `#` and
+	// `${frame}` substitutions, we evaluate it at two different frames,
+	// which also accounts for names computed by expressions.
+	const float frame = Context::current()->getFrame();
+	const std::string fileName = fileNamePlug()->getValue();
+
+	Context::EditableScope nextFrameScope( Context::current() );
+	nextFrameScope.setFrame( frame + 1.0f );
+	return fileNamePlug()->getValue() != fileName;
+}
+
 void ImageWriter::execute() const
 {
 	// Set up a context to pass the right colorspace to
@@ -296,6 +296,14 @@ IECore::ConstFloatVectorDataPtr Merge::merge( F f, const std::string &channelNam
 
 	const Box2i tileBound( tileOrigin, tileOrigin + V2i( ImagePlug::tileSize() ) );
 
+	// While every layer is constant and covers the whole tile, we composite
+	// single values rather than whole tiles, only expanding them into full
+	// tiles if we encounter a layer which isn't constant.
+	bool constant = true;
+	bool haveConstantResult = false;
+	float constantB = 0.0f;
+	float constantb = 0.0f;
+
 	for( ImagePlugIterator it( inPlugs() ); !it.done(); ++it )
 	{
 		if( !(*it)->getInput<ValuePlug>() )
@@ -336,6 +344,36 @@ IECore::ConstFloatVectorDataPtr Merge::merge( F f, const std::string &channelNam
 			alphaData = ImagePlug::blackTile();
 		}
 
+		if( constant )
+		{
+			float constantA, constanta;
+			if(
+				validBound == tileBound &&
+				ImagePlug::isConstantTile( channelData.get(), constantA ) &&
+				ImagePlug::isConstantTile( alphaData.get(), constanta )
+			)
+			{
+				if( !haveConstantResult )
+				{
+					constantB = constantA;
+					constantb = constanta;
+					haveConstantResult = true;
+				}
+				else
+				{
+					constantB = f( constantA, constantB, constanta, constantb );
+					constantb = f( constanta, constantb, constanta, constantb );
+				}
+				continue;
+			}
+
+			constant = false;
+			if( haveConstantResult )
+			{
+				resultData = new FloatVectorData( vector<float>( ImagePlug::tileSize() * ImagePlug::tileSize(), constantB ) );
+				resultAlphaData = new FloatVectorData( vector<float>( ImagePlug::tileSize() * ImagePlug::tileSize(), constantb ) );
+			}
+		}
 
 		if( !resultData )
 		{
@@ -390,5 +428,10 @@ IECore::ConstFloatVectorDataPtr Merge::merge( F f, const std::string &channelNam
 		}
 	}
 
+	if( haveConstantResult && constant )
+	{
+		return ImagePlug::constantTile( constantB );
+	}
+
 	return resultData;
 }
@@ -40,12 +40,42 @@
 
 #include "Gaffer/Context.h"
 
+#include <cmath>
+
 using namespace std;
 using namespace Imath;
 using namespace IECore;
 using namespace Gaffer;
 using namespace GafferImage;
 
+//////////////////////////////////////////////////////////////////////////
+// Utilities
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// The offset is specified at full resolution, so must be scaled to match the
+// resolution level being computed. We round to the nearest whole pixel, so
+// that the offset remains a straight copy of the input pixels.
+V2i scaledOffset( const V2iPlug *offsetPlug, const Gaffer::Context *context )
+{
+	const V2i offset = offsetPlug->getValue();
+	const int level = ImagePlug::resolutionLevel( context );
+	if( !level )
+	{
+		return offset;
+	}
+
+	const float scale = Format::resolutionScale( level );
+	return V2i(
+		(int)roundf( (float)offset.x * scale ),
+		(int)roundf( (float)offset.y * scale )
+	);
+}
+
+} // namespace
+
 //////////////////////////////////////////////////////////////////////////
 // Offset node
 //////////////////////////////////////////////////////////////////////////
@@ -102,7 +132,7 @@ void Offset::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs
 
 void Offset::hashDataWindow( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
-	const V2i offset = offsetPlug()->getValue();
+	const V2i offset = scaledOffset( offsetPlug(), context );
 	if( offset == V2i( 0 ) )
 	{
 		h = inPlug()->dataWindowPlug()->hash();
@@ -111,7 +141,7 @@ void Offset::hashDataWindow( const GafferImage::ImagePlug *parent, const Gaffer:
 	{
 		ImageProcessor::hashDataWindow( parent, context, h );
 		inPlug()->dataWindowPlug()->hash( h );
-		offsetPlug()->hash( h );
+		h.append( offset );
 	}
 }
 
@@ -120,7 +150,7 @@ Imath::Box2i Offset::computeDataWindow( const Gaffer::Context *context, const Im
 	Box2i dataWindow = inPlug()->dataWindowPlug()->getValue();
 	if( !dataWindow.isEmpty() )
 	{
-		const V2i offset = offsetPlug()->getValue();
+		const V2i offset = scaledOffset( offsetPlug(), context );
 		dataWindow.min += offset;
 		dataWindow.max += offset;
 	}
@@ -131,7 +161,7 @@ void Offset::hashChannelData( const GafferImage::ImagePlug *parent, const Gaffer
 {
 	ImagePlug::ChannelDataScope offsetScope( context );
 
-	const V2i offset = offsetPlug()->getValue();
+	const V2i offset = scaledOffset( offsetPlug(), context );
 	const V2i tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
 	if( offset.x % ImagePlug::tileSize() == 0 && offset.y % ImagePlug::tileSize() == 0 )
 	{
@@ -173,7 +203,7 @@ IECore::ConstFloatVectorDataPtr Offset::computeChannelData( const std::string &c
 {
 	ImagePlug::ChannelDataScope offsetScope( context );
 
-	const V2i offset = offsetPlug()->getValue();
+	const V2i offset = scaledOffset( offsetPlug(), context );
 	if( offset.x % ImagePlug::tileSize() == 0 && offset.y % ImagePlug::tileSize() == 0 )
 	{
 		offsetScope.setTileOrigin( tileOrigin - offset );
@@ -38,11 +38,14 @@
 
 #include "Gaffer/Context.h"
 
+#include "IECore/LRUCache.h"
 #include "IECore/SimpleTypedData.h"
 
 #include "tbb/mutex.h"
 #include "tbb/null_mutex.h"
 
+#include <algorithm>
+
 using namespace std;
 using namespace IECore;
 using namespace Gaffer;
@@ -66,6 +69,47 @@ typedef tbb::null_mutex OCIOMutex;
 
 static OCIOMutex g_ocioMutex;
 
+// Processor cache
+// ===============
+//
+// Creating a processor can be far more expensive than applying it to a
+// tile, particularly for complex transforms such as ACES output transforms.
+// OpenColorIO doesn't cache processors itself, so we cache them here, keyed
+// on the config, the OCIO context, the node type and the hash of the node's
+// transform.
+// Tiles are processed independently, so without the cache we would build
+// an identical processor for every single tile.
+
+struct ProcessorCacheGetterKey
+{
+
+	ProcessorCacheGetterKey( const IECore::MurmurHash &hash, OpenColorIO::ConstConfigRcPtr config, OpenColorIO::ConstContextRcPtr context, OpenColorIO::ConstTransformRcPtr transform )
+		:	hash( hash ), config( config ), context( context ), transform( transform )
+	{
+	}
+
+	operator const IECore::MurmurHash & () const
+	{
+		return hash;
+	}
+
+	const IECore::MurmurHash hash;
+	OpenColorIO::ConstConfigRcPtr config;
+	OpenColorIO::ConstContextRcPtr context;
+	OpenColorIO::ConstTransformRcPtr transform;
+
+};
+
+OpenColorIO::ConstProcessorRcPtr processorGetter( const ProcessorCacheGetterKey &key, size_t &cost )
+{
+	cost = 1;
+	OCIOMutex::scoped_lock lock( g_ocioMutex );
+	return key.config->getProcessor( key.context, key.transform, OpenColorIO::TRANSFORM_DIR_FORWARD );
+}
+
+typedef LRUCache<IECore::MurmurHash, OpenColorIO::ConstProcessorRcPtr, LRUCachePolicy::Parallel, ProcessorCacheGetterKey> ProcessorCache;
+ProcessorCache g_processorCache( processorGetter, 1000 );
+
 } // namespace
 
 IE_CORE_DEFINERUNTIMETYPED( OpenColorIOTransform );
@@ -197,9 +241,18 @@ OpenColorIO::ConstContextRcPtr OpenColorIOTransform::ocioContext(OpenColorIO::Co
 void OpenColorIOTransform::processColorData( const Gaffer::Context *context, IECore::FloatVectorData *r, IECore::FloatVectorData *g, IECore::FloatVectorData *b ) const
 {
 	OpenColorIO::ConstTransformRcPtr colorTransform;
+	MurmurHash processorHash;
 	{
 		ImagePlug::GlobalScope c( context );
 		colorTransform = transform();
+		// Different node types may hash their transform plugs identically,
+		// despite creating different transforms from them.
+		processorHash.append( typeId() );
+		hashTransform( context, processorHash );
+		if( contextPlug() )
+		{
+			contextPlug()->hash( processorHash );
+		}
 	}
 
 	if( !colorTransform )
@@ -207,12 +260,38 @@ void OpenColorIOTransform::processColorData( const Gaffer::Context *context, IEC
 		return;
 	}
 
-	OpenColorIO::ConstProcessorRcPtr processor;
+	OpenColorIO::ConstConfigRcPtr config;
+	OpenColorIO::ConstContextRcPtr processorContext;
 	{
 		OCIOMutex::scoped_lock lock( g_ocioMutex );
-		OpenColorIO::ConstConfigRcPtr config = OpenColorIO::GetCurrentConfig();
-		OpenColorIO::ConstContextRcPtr context = ocioContext( config );
-		processor = config->getProcessor( context, colorTransform, OpenColorIO::TRANSFORM_DIR_FORWARD );
+		config = OpenColorIO::GetCurrentConfig();
+		processorContext = ocioContext( config );
+		processorHash.append( config->getCacheID( processorContext ) );
+	}
+
+	OpenColorIO::ConstProcessorRcPtr processor = g_processorCache.get(
+		ProcessorCacheGetterKey( processorHash, config, processorContext, colorTransform )
+	);
+
+	if( processor->isNoOp() )
+	{
+		return;
+	}
+
+	// Constant tiles are common in padded data windows and mattes,
+	// and need only have a single pixel processed.
+	float rgb[3];
+	if(
+		ImagePlug::isConstantTile( r, rgb[0] ) &&
+		ImagePlug::isConstantTile( g, rgb[1] ) &&
+		ImagePlug::isConstantTile( b, rgb[2] )
+	)
+	{
+		processor->applyRGB( rgb );
+		std::fill( r->writable().begin(), r->writable().end(), rgb[0] );
+		std::fill( g->writable().begin(), g->writable().end(), rgb[1] );
+		std::fill( b->writable().begin(), b->writable().end(), rgb[2] );
+		return;
 	}
 
 	OpenColorIO::PlanarImageDesc image(
@@ -40,26 +40,37 @@
 #include "GafferImage/FormatPlug.h"
 #include "GafferImage/ImageAlgo.h"
 
+#include "Gaffer/BackgroundTask.h"
 #include "Gaffer/Context.h"
+#include "Gaffer/ParallelAlgo.h"
 #include "Gaffer/StringPlug.h"
 
 #include "IECoreImage/OpenImageIOAlgo.h"
 
+#include "IECore/Canceller.h"
 #include "IECore/Export.h"
 #include "IECore/FileSequence.h"
 #include "IECore/FileSequenceFunctions.h"
 #include "IECore/LRUCache.h"
 #include "IECore/MessageHandler.h"
+#include "IECore/VectorTypedData.h"
 
 #include "OpenImageIO/imagecache.h"
+#include "OpenImageIO/imageio.h"
 
 #include "boost/bind.hpp"
 #include "boost/filesystem/path.hpp"
 #include "boost/regex.hpp"
 
 #include "tbb/mutex.h"
+#include "tbb/parallel_for.h"
+#include "tbb/task_arena.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <memory>
+#include <set>
 
 OIIO_NAMESPACE_USING
 
@@ -75,19 +86,35 @@ namespace
 
 const IECore::InternedString g_tileBatchIndexContextName( "__tileBatchIndex" );
 
+// A contiguous range of channels within a subimage, which are
+// read from the file together.
+struct ChannelGroup
+{
+	ChannelGroup( int subImage, int channelBegin, int channelEnd )
+		: subImage( subImage ), channelBegin( channelBegin ), channelEnd( channelEnd )
+	{}
+
+	int subImage;
+	int channelBegin;
+	int channelEnd;
+};
+
 struct ChannelMapEntry
 {
-	ChannelMapEntry( int subImage, int channelIndex )
-		: subImage( subImage ), channelIndex( channelIndex )
+	ChannelMapEntry( int subImage, int group, int channelIndex )
+		: subImage( subImage ), group( group ), channelIndex( channelIndex )
 	{}
 
 	ChannelMapEntry( const ChannelMapEntry & ) = default;
 
 	ChannelMapEntry()
-		: subImage( 0 ), channelIndex( 0 )
+		: subImage( 0 ), group( 0 ), channelIndex( 0 )
 	{}
 
 	int subImage;
+	// Index into File::m_channelGroups.
+	int group;
+	// Index of the channel within the group.
 	int channelIndex;
 };
 
@@ -117,6 +144,163 @@ V2i coordinateDivide( V2i a, V2i b )
 	return V2i( coordinateDivide( a.x, b.x ), coordinateDivide( a.y, b.y ) );
 }
 
+// Tile storage
+// ============
+//
+// Tiles are stored in the tile batch in one of three forms :
+//
+// - Uncompressed, as TypedData holding `tileSize * tileSize` samples.
+// - Constant, as TypedData holding a single sample. This makes black padding
+//   and mattes almost free to cache.
+// - Compressed, as CharVectorData. The first element is the `TypeDesc::BASETYPE`
+//   of the uncompressed samples, and the remainder is a run-length encoding of
+//   the sample bytes, reordered so that the first bytes of every sample come
+//   first, followed by the second bytes and so on. For image data the most
+//   significant bytes vary slowly, so this reordering exposes long runs that
+//   the encoding can take advantage of.
+//
+// Since the cache cost of a tile batch is computed from the memory usage of
+// its members, compressed tiles are accounted for at their compressed size.
+
+std::atomic<bool> g_cacheCompression( false );
+
+// Encodes `[begin, end)` as a series of packets, each starting with a header byte.
+// Headers less than 128 are followed by `header + 1` literal bytes, and other headers
+// are followed by a single byte to be repeated `header - 125` times.
+void runLengthEncode( const unsigned char *begin, const unsigned char *end, std::vector<char> &encoded )
+{
+	const unsigned char *literalsBegin = begin;
+	auto appendLiterals = [&literalsBegin, &encoded]( const unsigned char *literalsEnd ) {
+		while( literalsBegin < literalsEnd )
+		{
+			const size_t n = std::min<size_t>( literalsEnd - literalsBegin, 128 );
+			encoded.push_back( static_cast<char>( n - 1 ) );
+			encoded.insert( encoded.end(), literalsBegin, literalsBegin + n );
+			literalsBegin += n;
+		}
+	};
+
+	const unsigned char *it = begin;
+	while( it < end )
+	{
+		const unsigned char *runEnd = it + 1;
+		while( runEnd < end && *runEnd == *it && runEnd - it < 130 )
+		{
+			++runEnd;
+		}
+
+		// Runs shorter than 3 would take more space encoded
+		// than they do as literals.
+		if( runEnd - it >= 3 )
+		{
+			appendLiterals( it );
+			encoded.push_back( static_cast<char>( runEnd - it + 125 ) );
+			encoded.push_back( static_cast<char>( *it ) );
+			literalsBegin = runEnd;
+		}
+		it = runEnd;
+	}
+	appendLiterals( end );
+}
+
+void runLengthDecode( const char *encoded, unsigned char *begin, unsigned char *end )
+{
+	const unsigned char *in = reinterpret_cast<const unsigned char *>( encoded );
+	while( begin < end )
+	{
+		const unsigned char header = *in++;
+		if( header < 128 )
+		{
+			begin = std::copy( in, in + header + 1, begin );
+			in += header + 1;
+		}
+		else
+		{
+			const unsigned char value = *in++;
+			begin = std::fill_n( begin, header - 125, value );
+		}
+	}
+}
+
+// Returns a compact representation of `tile`, which may be `tile` itself.
+template<typename DataType>
+ObjectPtr compactTile( DataType *tile, TypeDesc format )
+{
+	typedef typename DataType::ValueType::value_type ElementType;
+	const std::vector<ElementType> &samples = tile->readable();
+
+	// We compare bytes rather than values, so that we treat
+	// NaNs and signed zeroes correctly.
+	const unsigned char *bytes = reinterpret_cast<const unsigned char *>( samples.data() );
+	const size_t numBytes = samples.size() * sizeof( ElementType );
+	bool constant = true;
+	for( size_t i = sizeof( ElementType ); i < numBytes; i += sizeof( ElementType ) )
+	{
+		if( memcmp( bytes, bytes + i, sizeof( ElementType ) ) )
+		{
+			constant = false;
+			break;
+		}
+	}
+
+	if( constant )
+	{
+		return new DataType( std::vector<ElementType>( 1, samples[0] ) );
+	}
+
+	if( !g_cacheCompression )
+	{
+		return tile;
+	}
+
+	std::vector<unsigned char> shuffled( numBytes );
+	for( size_t b = 0; b < sizeof( ElementType ); ++b )
+	{
+		unsigned char *plane = shuffled.data() + b * samples.size();
+		for( size_t i = 0; i < samples.size(); ++i )
+		{
+			plane[i] = bytes[i * sizeof( ElementType ) + b];
+		}
+	}
+
+	CharVectorDataPtr compressed = new CharVectorData;
+	std::vector<char> &encoded = compressed->writable();
+	encoded.push_back( static_cast<char>( format.basetype ) );
+	runLengthEncode( shuffled.data(), shuffled.data() + numBytes, encoded );
+	if( encoded.size() >= numBytes )
+	{
+		// Incompressible
+		return tile;
+	}
+
+	encoded.shrink_to_fit();
+	return compressed;
+}
+
+// Decompresses a tile compressed by `compactTile()`, returning the format of the samples.
+TypeDesc decompressTile( const CharVectorData *tile, std::vector<unsigned char> &samples )
+{
+	const std::vector<char> &encoded = tile->readable();
+	const TypeDesc format( static_cast<TypeDesc::BASETYPE>( encoded[0] ) );
+	const size_t numSamples = ImagePlug::tileSize() * ImagePlug::tileSize();
+	const size_t sampleSize = format.size();
+
+	std::vector<unsigned char> shuffled( numSamples * sampleSize );
+	runLengthDecode( encoded.data() + 1, shuffled.data(), shuffled.data() + shuffled.size() );
+
+	samples.resize( shuffled.size() );
+	for( size_t b = 0; b < sampleSize; ++b )
+	{
+		const unsigned char *plane = shuffled.data() + b * numSamples;
+		for( size_t i = 0; i < numSamples; ++i )
+		{
+			samples[i * sampleSize + b] = plane[i];
+		}
+	}
+
+	return format;
+}
+
 // This class handles storing a file handle, and reading data from it in a way compatible with how we want
 // to store it on plugs.
 //
@@ -135,9 +319,18 @@ V2i coordinateDivide( V2i a, V2i b )
 // For tiled images, a tile batch is a fairly large fixed size ( current 512 pixels, or the tile size of the
 // image, whichever is larger ).  This amortizes the waste from tiles which lie over the edge of a tile batch,
 // and need to be read multiple times.
-// Either way, a tile batch contains all channels stored in the subimage which contains the desired channel.
+// Either way, a tile batch contains all the channels of the layer containing the desired channel, taken from
+// the subimage in which they are stored. Multi-layer files often contain dozens of channels, of which a comp
+// may only need a few, so reading a layer at a time means we never decode or cache the layers which aren't
+// used. Requests for other channels in the same layer share the tile batch, so the common case of reading
+// R, G, B and A together still reads the file only once. We call the channels read together a "channel group".
 //
-// Tile batches are selected using V3i "tileBatchIndex".  The Z component is the subimage to load channels from.
+// When reading at a reduced resolution level ( see ImagePlug::resolutionLevelContextName ), the File presents
+// an image spec scaled to that level, and all the logic below operates in the reduced pixel space. Only
+// readRegion() needs to know about the level, reading from the closest MIP level stored in the file, and
+// filtering down from there if the file doesn't contain the level we want.
+//
+// Tile batches are selected using V3i "tileBatchIndex".  The Z component is the channel group to load channels from.
 // The X and Y component select a region of the image.
 // For tiled images, the <0,0> tileBatch is at the origin of the image, and the X and Y components specify
 // how many tile batches to offset from that, horizontally and vertically.
@@ -152,8 +345,8 @@ class File
 	public:
 
 		// Create a File handle object for an image input and image spec
-		File( std::unique_ptr<ImageInput> imageInput, ImageSpec imageSpec, const std::string &infoFileName )
-			: m_imageInput( std::move( imageInput ) ), m_imageSpec( imageSpec )
+		File( std::unique_ptr<ImageInput> imageInput, ImageSpec imageSpec, const std::string &infoFileName, int resolutionLevel )
+			: m_imageInput( std::move( imageInput ) ), m_imageSpec( imageSpec ), m_resolutionLevel( resolutionLevel ), m_fileLevel( 0 )
 		{
 			std::vector<std::string> channelNames;
 
@@ -187,9 +380,24 @@ class File
 
 				const OIIO::string_view subImageName = currentSpec.get_string_attribute( "name", "" );
 
+				std::string groupLayerName;
 				for( const auto &n : currentSpec.channelnames )
 				{
 					std::string channelName = ImageAlgo::channelName( subImageName, n );
+					const int subImageChannelIndex = &n - &currentSpec.channelnames[0];
+
+					// Group consecutive channels belonging to the same layer.
+					const std::string layerName = ImageAlgo::layerName( channelName );
+					if( subImageChannelIndex == 0 || layerName != groupLayerName )
+					{
+						m_channelGroups.push_back( ChannelGroup( subImageIndex, subImageChannelIndex, subImageChannelIndex + 1 ) );
+						groupLayerName = layerName;
+					}
+					else
+					{
+						m_channelGroups.back().channelEnd = subImageChannelIndex + 1;
+					}
+
 					auto mapEntry = m_channelMap.find( channelName );
 					if( mapEntry != m_channelMap.end() )
 					{
@@ -200,7 +408,10 @@ class File
 					}
 					else
 					{
-						m_channelMap[ channelName ] = ChannelMapEntry( subImageIndex, &n - &currentSpec.channelnames[0] );
+						m_channelMap[ channelName ] = ChannelMapEntry(
+							subImageIndex, m_channelGroups.size() - 1,
+							subImageChannelIndex - m_channelGroups.back().channelBegin
+						);
 						channelNames.push_back( channelName );
 					}
 				}
@@ -209,6 +420,49 @@ class File
 
 			m_channelNamesData = new StringVectorData( channelNames );
 
+			if( m_resolutionLevel > 0 )
+			{
+				// Find the closest MIP level available in all the subimages
+				// we read channels from.
+				std::set<int> subImages;
+				for( const auto &c : m_channelMap )
+				{
+					subImages.insert( c.second.subImage );
+				}
+
+				m_fileLevel = subImages.size() ? m_resolutionLevel : 0;
+				ImageSpec levelSpec;
+				for( int subImage : subImages )
+				{
+					int level = 0;
+					while( level < m_fileLevel && m_imageInput->seek_subimage( subImage, level + 1, levelSpec ) )
+					{
+						level++;
+					}
+					m_fileLevel = level;
+				}
+
+				// Scale our spec to the level, so that everything else
+				// can operate in reduced resolution pixels.
+				m_levelZeroOrigin = V2i( m_imageSpec.x, m_imageSpec.y );
+				const Box2i dataWindow = Format::atResolutionLevel(
+					Box2i( V2i( m_imageSpec.x, m_imageSpec.y ), V2i( m_imageSpec.x + m_imageSpec.width, m_imageSpec.y + m_imageSpec.height ) ),
+					m_resolutionLevel
+				);
+				const Box2i displayWindow = Format::atResolutionLevel(
+					Box2i( V2i( m_imageSpec.full_x, m_imageSpec.full_y ), V2i( m_imageSpec.full_x + m_imageSpec.full_width, m_imageSpec.full_y + m_imageSpec.full_height ) ),
+					m_resolutionLevel
+				);
+				m_imageSpec.x = dataWindow.min.x;
+				m_imageSpec.y = dataWindow.min.y;
+				m_imageSpec.width = dataWindow.size().x;
+				m_imageSpec.height = dataWindow.size().y;
+				m_imageSpec.full_x = displayWindow.min.x;
+				m_imageSpec.full_y = displayWindow.min.y;
+				m_imageSpec.full_width = displayWindow.size().x;
+				m_imageSpec.full_height = displayWindow.size().y;
+			}
+
 			if( m_imageSpec.tile_width == 0 && m_imageSpec.tile_height == 0 )
 			{
 				m_tiled = false;
@@ -234,16 +488,23 @@ class File
 			}
 		}
 
-		// Fill the data array with all data for the specified subImage and target region,
+		// Fill the data array with all data for the specified channel group and target region,
 		// setting the dataRegion to represent the actual bounds of the data read ( which may have had to
 		// be enlarged to match tile boundaries ), and returning the number of channels read
 		//
 		// This is currenly only used by readTileBatch below - we always cache to tile batches when reading
 		// channel data.
-		int readRegion( int subImage, const Box2i &targetRegion, std::vector<float> &data, Box2i &dataRegion )
+		template<typename T>
+		int readRegion( const ChannelGroup &group, const Box2i &targetRegion, TypeDesc format, std::vector<T> &data, Box2i &dataRegion )
 		{
+			if( m_resolutionLevel > 0 )
+			{
+				return readReducedRegion( group, targetRegion, data, dataRegion );
+			}
+
 			ImageSpec subImageSpec;
-			m_imageInput->seek_subimage( subImage, 0, subImageSpec );
+			m_imageInput->seek_subimage( group.subImage, 0, subImageSpec );
+			const int nchannels = group.channelEnd - group.channelBegin;
 
 			const V2i fileDataOrigin( m_imageSpec.x, m_imageSpec.y );
 			const Box2i fileDataWindow( fileDataOrigin,
@@ -261,9 +522,9 @@ class File
 			{
 				fileDataRegion = fileTargetRegion;
 
-				data.resize( subImageSpec.nchannels * fileDataRegion.size().x * fileDataRegion.size().y );
+				data.resize( nchannels * fileDataRegion.size().x * fileDataRegion.size().y );
 
-				if( !m_imageInput->read_scanlines( fileDataRegion.min.y, fileDataRegion.max.y, 0, TypeDesc::FLOAT, &data[0] ) )
+				if( !m_imageInput->read_scanlines( fileDataRegion.min.y, fileDataRegion.max.y, 0, group.channelBegin, group.channelEnd, format, &data[0] ) )
 				{
 					throw IECore::Exception( boost::str (
 						boost::format( "OpenImageIOReader : Failed to read scanlines %i to %i.  Error: %s" ) %
@@ -288,11 +549,12 @@ class File
 					coordinateDivide( fileTargetRegion.max - fileDataOrigin + tileSize - V2i(1), tileSize ) * tileSize + fileDataOrigin
 				) );
 
-				data.resize( subImageSpec.nchannels * fileDataRegion.size().x * fileDataRegion.size().y );
+				data.resize( nchannels * fileDataRegion.size().x * fileDataRegion.size().y );
 
 				if( !m_imageInput->read_tiles (
 					fileDataRegion.min.x, fileDataRegion.max.x,
-					fileDataRegion.min.y, fileDataRegion.max.y, 0, 1, TypeDesc::FLOAT, &data[0]
+					fileDataRegion.min.y, fileDataRegion.max.y, 0, 1,
+					group.channelBegin, group.channelEnd, format, &data[0]
 				) )
 				{
 					throw IECore::Exception( boost::str (
@@ -306,12 +568,184 @@ class File
 
 			dataRegion = flopDisplayWindow( fileDataRegion, m_imageSpec.full_y, m_imageSpec.full_height );
 
-			return subImageSpec.nchannels;
+			return nchannels;
 		}
 
-		// Read a chunk of data from the file, formatted as a tile batch that will be stored on the tile batch plug
+		// As for readRegion(), but for reduced resolution levels. Reads from the closest MIP
+		// level in the file, using a box filter to reduce it the rest of the way to the
+		// level we want. The data is converted to T via float, so `readTileBatch()` always
+		// uses float storage for reduced levels.
+		template<typename T>
+		int readReducedRegion( const ChannelGroup &group, const Box2i &targetRegion, std::vector<T> &data, Box2i &dataRegion )
+		{
+			ImageSpec levelSpec;
+			if( !m_imageInput->seek_subimage( group.subImage, m_fileLevel, levelSpec ) )
+			{
+				throw IECore::Exception( boost::str(
+					boost::format( "OpenImageIOReader : Failed to seek to MIP level %i of subimage %i.  Error: %s" ) %
+					m_fileLevel % group.subImage % m_imageInput->geterror()
+				) );
+			}
+			const int nchannels = group.channelEnd - group.channelBegin;
+
+			// Region we want, in the file coordinate system at our reduced level.
+			const Box2i fileTargetRegion = BufferAlgo::intersection(
+				flopDisplayWindow( targetRegion, m_imageSpec.full_y, m_imageSpec.full_height ),
+				Box2i( V2i( m_imageSpec.x, m_imageSpec.y ), V2i( m_imageSpec.x + m_imageSpec.width, m_imageSpec.y + m_imageSpec.height ) )
+			);
+
+			data.clear();
+			if( BufferAlgo::empty( fileTargetRegion ) )
+			{
+				dataRegion = Box2i();
+				return nchannels;
+			}
+			dataRegion = flopDisplayWindow( fileTargetRegion, m_imageSpec.full_y, m_imageSpec.full_height );
+
+			// Maps a pixel at our level to the first pixel it covers in the MIP level
+			// we're reading from. Pixel `p` covers `[levelPixel( p ), levelPixel( p + 1 ) )`.
+			const V2i levelOrigin( levelSpec.x, levelSpec.y );
+			const V2i fileLevelSize( 1 << m_fileLevel );
+			auto levelPixel = [this, &levelOrigin, &fileLevelSize] ( const V2i &p ) {
+				return levelOrigin + coordinateDivide( p * ( 1 << m_resolutionLevel ) - m_levelZeroOrigin, fileLevelSize );
+			};
+
+			const Box2i levelDataWindow( levelOrigin, levelOrigin + V2i( levelSpec.width, levelSpec.height ) );
+			Box2i levelRegion = BufferAlgo::intersection(
+				levelDataWindow, Box2i( levelPixel( fileTargetRegion.min ), levelPixel( fileTargetRegion.max ) )
+			);
+
+			std::vector<float> levelData;
+			if( !m_tiled )
+			{
+				levelRegion.min.x = levelDataWindow.min.x;
+				levelRegion.max.x = levelDataWindow.max.x;
+				levelData.resize( nchannels * levelRegion.size().x * levelRegion.size().y );
+				if( !BufferAlgo::empty( levelRegion ) && !m_imageInput->read_scanlines( levelRegion.min.y, levelRegion.max.y, 0, group.channelBegin, group.channelEnd, TypeDesc::FLOAT, levelData.data() ) )
+				{
+					throw IECore::Exception( boost::str (
+						boost::format( "OpenImageIOReader : Failed to read scanlines %i to %i.  Error: %s" ) %
+						levelRegion.min.y % levelRegion.max.y %
+						m_imageInput->geterror()
+					) );
+				}
+			}
+			else
+			{
+				const V2i tileSize( levelSpec.tile_width, levelSpec.tile_height );
+				levelRegion = BufferAlgo::intersection( levelDataWindow, Box2i(
+					coordinateDivide( levelRegion.min - levelOrigin, tileSize ) * tileSize + levelOrigin,
+					coordinateDivide( levelRegion.max - levelOrigin + tileSize - V2i( 1 ), tileSize ) * tileSize + levelOrigin
+				) );
+				levelData.resize( nchannels * levelRegion.size().x * levelRegion.size().y );
+				if( !BufferAlgo::empty( levelRegion ) && !m_imageInput->read_tiles(
+					levelRegion.min.x, levelRegion.max.x,
+					levelRegion.min.y, levelRegion.max.y, 0, 1,
+					group.channelBegin, group.channelEnd, TypeDesc::FLOAT, levelData.data()
+				) )
+				{
+					throw IECore::Exception( boost::str (
+						boost::format( "OpenImageIOReader : Failed to read tiles %i,%i to %i,%i.  Error: %s" ) %
+						levelRegion.min.x % levelRegion.min.y %
+						levelRegion.max.x % levelRegion.max.y %
+						m_imageInput->geterror()
+					) );
+				}
+			}
+
+			// Box filter down to our level. When the file contains the
+			// level we want, each pixel covers exactly one file pixel.
+			const V2i size = fileTargetRegion.size();
+			data.resize( nchannels * size.x * size.y );
+			std::vector<float> sums( nchannels );
+			V2i p;
+			for( p.y = fileTargetRegion.min.y; p.y < fileTargetRegion.max.y; ++p.y )
+			{
+				for( p.x = fileTargetRegion.min.x; p.x < fileTargetRegion.max.x; ++p.x )
+				{
+					const Box2i footprint = BufferAlgo::intersection(
+						levelRegion, Box2i( levelPixel( p ), levelPixel( p + V2i( 1 ) ) )
+					);
+
+					std::fill( sums.begin(), sums.end(), 0.0f );
+					V2i q;
+					for( q.y = footprint.min.y; q.y < footprint.max.y; ++q.y )
+					{
+						const float *levelPixels = &levelData[
+							( ( q.y - levelRegion.min.y ) * levelRegion.size().x + footprint.min.x - levelRegion.min.x ) * nchannels
+						];
+						for( q.x = footprint.min.x; q.x < footprint.max.x; ++q.x )
+						{
+							for( int c = 0; c < nchannels; ++c )
+							{
+								sums[c] += *levelPixels++;
+							}
+						}
+					}
+
+					const int count = std::max( 1, footprint.size().x * footprint.size().y );
+					T *pixel = &data[( ( p.y - fileTargetRegion.min.y ) * size.x + p.x - fileTargetRegion.min.x ) * nchannels];
+					for( int c = 0; c < nchannels; ++c )
+					{
+						pixel[c] = static_cast<T>( sums[c] / count );
+					}
+				}
+			}
+
+			return nchannels;
+		}
+
+		// Read a chunk of data from the file, formatted as a tile batch that will be stored on the tile batch plug.
+		//
+		// Where possible, the tiles are stored in the native format of the file rather than as floats, to
+		// reduce the memory used by the cache. Tiles are further compacted using `compactTile()`. They are
+		// expanded and converted to float as they are requested by computeChannelData(), using
+		// `channelDataFromStorage()`.
 		ConstObjectVectorPtr readTileBatch( V3i tileBatchIndex )
 		{
+			const ChannelGroup &group = m_channelGroups[tileBatchIndex.z];
+			ImageSpec subImageSpec;
+			m_imageInput->seek_subimage( group.subImage, 0, subImageSpec );
+
+			// We only store formats which can be converted back to float
+			// exactly as OpenImageIO would have converted them on read. Files with
+			// per-channel formats commonly use a single format within each layer,
+			// so we only fall back to float if the channels in our group differ.
+			TypeDesc format = subImageSpec.format;
+			if( subImageSpec.channelformats.size() )
+			{
+				format = subImageSpec.channelformats[group.channelBegin];
+				for( int c = group.channelBegin + 1; c < group.channelEnd; ++c )
+				{
+					if( subImageSpec.channelformats[c] != format )
+					{
+						format = TypeDesc::FLOAT;
+						break;
+					}
+				}
+			}
+			if( m_resolutionLevel > 0 )
+			{
+				format = TypeDesc::FLOAT;
+			}
+			switch( format.basetype )
+			{
+				case TypeDesc::HALF :
+					return readTileBatch<HalfVectorData>( tileBatchIndex, format );
+				case TypeDesc::UINT8 :
+					return readTileBatch<UCharVectorData>( tileBatchIndex, format );
+				case TypeDesc::UINT16 :
+					return readTileBatch<UShortVectorData>( tileBatchIndex, format );
+				default :
+					return readTileBatch<FloatVectorData>( tileBatchIndex, TypeDesc::FLOAT );
+			}
+		}
+
+		template<typename DataType>
+		ConstObjectVectorPtr readTileBatch( V3i tileBatchIndex, TypeDesc format )
+		{
+			typedef typename DataType::ValueType::value_type ElementType;
+
 			V2i batchFirstTile = V2i( tileBatchIndex.x, tileBatchIndex.y ) * m_tileBatchSize;
 			Box2i targetRegion = Box2i( batchFirstTile * ImagePlug::tileSize(),
 				( batchFirstTile + m_tileBatchSize ) * ImagePlug::tileSize()
@@ -328,64 +762,88 @@ class File
 
 			// Do the actual read of data
 			//
-			// Note - this method is not thread-safe, but because this is a private plug is only computed from
-			// the computeChannelData method, it is safe to assume that we have already acquired m_mutex
+			// Note - this method is not thread-safe, but because this is a private plug is only computed via
+			// the tileBatch() function, it is safe to assume that we have already acquired m_mutex
 			// at this point
-			std::vector<float> fileData;
+			std::vector<ElementType> fileData;
 			Box2i fileDataRegion;
-			const int nchannels = readRegion( tileBatchIndex.z, targetRegion, fileData, fileDataRegion );
+			const int nchannels = readRegion( m_channelGroups[tileBatchIndex.z], targetRegion, format, fileData, fileDataRegion );
 
-			// Pull data apart into tiles ( separate for each channel instead of interleaved )
-			int tileBatchNumElements = nchannels * m_tileBatchSize.y * m_tileBatchSize.x;
+			// Pull data apart into tiles ( separate for each channel instead of interleaved ).
+			//
+			// We visit each tile once, filling the tiles for all channels in a single pass over the
+			// corresponding part of the file data. This means each interleaved pixel is read from memory
+			// once rather than once per channel, which matters for files with many channels. Note that
+			// we can't avoid this copy entirely by referencing the file data directly, because ImagePlug
+			// requires each tile to be a separate, contiguous array of samples for a single channel.
+			const int tileSize = ImagePlug::tileSize();
+			const int tileBatchNumElements = nchannels * m_tileBatchSize.y * m_tileBatchSize.x;
 			ObjectVectorPtr result = new ObjectVector();
 			result->members().resize( tileBatchNumElements );
 
-			for( int c = 0; c < nchannels; c++ )
+			std::vector<typename DataType::Ptr> channelData( nchannels );
+			std::vector<ElementType *> channelTiles( nchannels );
+			for( int ty = batchFirstTile.y; ty < batchFirstTile.y + m_tileBatchSize.y; ty++ )
 			{
-				for( int ty = batchFirstTile.y; ty < batchFirstTile.y + m_tileBatchSize.y; ty++ )
+				for( int tx = batchFirstTile.x; tx < batchFirstTile.x + m_tileBatchSize.x; tx++ )
 				{
-					for( int tx = batchFirstTile.x; tx < batchFirstTile.x + m_tileBatchSize.x; tx++ )
-					{
-						V2i tileOffset = ImagePlug::tileSize() * V2i( tx, ty );
-						Box2i tileRelativeFileRegion( fileDataRegion.min - tileOffset, fileDataRegion.max - tileOffset );
-						Box2i tileRegion = BufferAlgo::intersection(
-							Box2i( V2i( 0 ), V2i( ImagePlug::tileSize() ) ), tileRelativeFileRegion
-						);
+					const V2i tileOffset = tileSize * V2i( tx, ty );
+					const Box2i tileRelativeFileRegion( fileDataRegion.min - tileOffset, fileDataRegion.max - tileOffset );
+					const Box2i tileRegion = BufferAlgo::intersection(
+						Box2i( V2i( 0 ), V2i( tileSize ) ), tileRelativeFileRegion
+					);
 
-						if( BufferAlgo::empty( tileRegion ) )
+					if( BufferAlgo::empty( tileRegion ) )
+					{
+						for( int c = 0; c < nchannels; c++ )
 						{
 							// Result will be treated as const as soon as we set it on the plug, and we're not
 							// going to modify any elements after setting them, so it's safe to store a const
 							// value in one of the elements
 							result->members()[ tileBatchSubIndex( c, tileOffset ) ] =
 								const_cast<FloatVectorData*>( ImagePlug::blackTile() );
-							continue;
 						}
+						continue;
+					}
 
-						FloatVectorDataPtr tileData = new IECore::FloatVectorData(
-							std::vector<float>( ImagePlug::tileSize()*ImagePlug::tileSize() )
+					for( int c = 0; c < nchannels; c++ )
+					{
+						// Note that we must initialise explicitly, because `half` has
+						// no default initialisation.
+						channelData[c] = new DataType(
+							std::vector<ElementType>( tileSize * tileSize, ElementType( 0 ) )
 						);
-						vector<float> &tile = tileData->writable();
+						channelTiles[c] = &channelData[c]->writable()[0];
+					}
 
-						for( int y = tileRegion.min.y; y < tileRegion.max.y; ++y )
+					const int tileRegionWidth = tileRegion.size().x;
+					for( int y = tileRegion.min.y; y < tileRegion.max.y; ++y )
+					{
+						const int tileIndex = y * tileSize + tileRegion.min.x;
+						const int scanline = fileDataRegion.size().y - 1 - (y - tileRelativeFileRegion.min.y);
+						const ElementType *dataIndex = &fileData[
+							( scanline * fileDataRegion.size().x + tileRegion.min.x - tileRelativeFileRegion.min.x
+							) * nchannels
+						];
+
+						if( nchannels == 1 )
 						{
+							std::copy( dataIndex, dataIndex + tileRegionWidth, channelTiles[0] + tileIndex );
+							continue;
+						}
 
-							float *tileIndex = &tile[ y * ImagePlug::tileSize() + tileRegion.min.x ];
-							int scanline = fileDataRegion.size().y - 1 - (y - tileRelativeFileRegion.min.y);
-							float *dataIndex = &fileData[
-								( scanline * fileDataRegion.size().x + tileRegion.min.x - tileRelativeFileRegion.min.x
-								) * nchannels + c
-							];
-							for( int x = tileRegion.min.x; x < tileRegion.max.x; x++ )
+						for( int x = 0; x < tileRegionWidth; x++ )
+						{
+							for( int c = 0; c < nchannels; c++ )
 							{
-								*tileIndex = *dataIndex;
-								tileIndex++;
-								dataIndex += nchannels;
+								channelTiles[c][tileIndex + x] = *dataIndex++;
 							}
 						}
+					}
 
-
-						result->members()[ tileBatchSubIndex( c, tileOffset ) ] = tileData;
+					for( int c = 0; c < nchannels; c++ )
+					{
+						result->members()[ tileBatchSubIndex( c, tileOffset ) ] = compactTile( channelData[c].get(), format );
 					}
 				}
 			}
@@ -399,10 +857,47 @@ class File
 		void findTile( const std::string &channelName, const Imath::V2i &tileOrigin, V3i &batchIndex, int &batchSubIndex ) const
 		{
 			ChannelMapEntry channelMapEntry = m_channelMap.at( channelName );
-			batchIndex = tileBatchIndex( channelMapEntry.subImage, tileOrigin );
+			batchIndex = tileBatchIndex( channelMapEntry.group, tileOrigin );
 			batchSubIndex = tileBatchSubIndex( channelMapEntry.channelIndex, tileOrigin );
 		}
 
+		// Returns the indices of all the tile batches needed to cover the data window,
+		// for every channel group we load channels from.
+		std::vector<V3i> tileBatchIndices() const
+		{
+			std::set<int> groups;
+			for( const auto &c : m_channelMap )
+			{
+				groups.insert( c.second.group );
+			}
+
+			const Box2i dataWindow = flopDisplayWindow(
+				Box2i( V2i( m_imageSpec.x, m_imageSpec.y ), V2i( m_imageSpec.x + m_imageSpec.width, m_imageSpec.y + m_imageSpec.height ) ),
+				m_imageSpec.full_y, m_imageSpec.full_height
+			);
+
+			std::vector<V3i> result;
+			if( BufferAlgo::empty( dataWindow ) )
+			{
+				return result;
+			}
+
+			const V3i first = tileBatchIndex( 0, ImagePlug::tileOrigin( dataWindow.min ) );
+			const V3i last = tileBatchIndex( 0, ImagePlug::tileOrigin( dataWindow.max - V2i( 1 ) ) );
+			for( int group : groups )
+			{
+				for( int y = last.y; y >= first.y; --y )
+				{
+					for( int x = first.x; x <= last.x; ++x )
+					{
+						result.push_back( V3i( x, y, group ) );
+					}
+				}
+			}
+
+			return result;
+		}
+
 		const ImageSpec &imageSpec() const
 		{
 			return m_imageSpec;
@@ -425,16 +920,16 @@ class File
 
 	private:
 
-		// Given a subImage index, and a tile origin, return an index to identify the tile batch which
+		// Given a channel group index, and a tile origin, return an index to identify the tile batch which
 		// where this channel data will be found
-		V3i tileBatchIndex( int subImage, V2i tileOrigin ) const
+		V3i tileBatchIndex( int group, V2i tileOrigin ) const
 		{
 			V2i tileBatchOrigin = coordinateDivide( ImagePlug::tileIndex( tileOrigin ), m_tileBatchSize );
 			if( !m_tiled )
 			{
 				tileBatchOrigin.x = 0;
 			}
-			return V3i( tileBatchOrigin.x, tileBatchOrigin.y, subImage );
+			return V3i( tileBatchOrigin.x, tileBatchOrigin.y, group );
 		}
 
 		// Given a channel index, and a tile origin, return the index within a tile batch where the correct
@@ -455,9 +950,16 @@ class File
 		}
 
 		std::unique_ptr<ImageInput> m_imageInput;
+		// Scaled to m_resolutionLevel.
 		ImageSpec m_imageSpec;
+		int m_resolutionLevel;
+		// The MIP level we read from.
+		int m_fileLevel;
+		// Origin of the data window at full resolution.
+		Imath::V2i m_levelZeroOrigin;
 		ConstStringVectorDataPtr m_channelNamesData;
 		std::map<std::string, ChannelMapEntry> m_channelMap;
+		std::vector<ChannelGroup> m_channelGroups;
 		Imath::V2i m_tileBatchSize;
 		tbb::mutex m_mutex;
 		bool m_tiled;
@@ -476,10 +978,39 @@ struct CacheEntry
 };
 
 
-CacheEntry fileCacheGetter( const std::string &fileName, size_t &cost )
+struct FileHandleCacheGetterKey
+{
+
+	FileHandleCacheGetterKey()
+		:	resolutionLevel( 0 )
+	{
+	}
+
+	FileHandleCacheGetterKey( const std::string &fileName, int resolutionLevel )
+		:	fileName( fileName ), resolutionLevel( resolutionLevel )
+	{
+		// Full resolution files are keyed by file name alone, and reduced
+		// resolutions by a suffix which can't appear in a file name.
+		key = resolutionLevel ? fileName + "\n" + std::to_string( resolutionLevel ) : fileName;
+	}
+
+	operator const std::string & () const
+	{
+		return key;
+	}
+
+	std::string fileName;
+	int resolutionLevel;
+	std::string key;
+
+};
+
+CacheEntry fileCacheGetter( const FileHandleCacheGetterKey &key, size_t &cost )
 {
 	cost = 1;
 
+	const std::string &fileName = key.fileName;
+
 	CacheEntry result;
 
 	ImageSpec imageSpec;
@@ -501,12 +1032,12 @@ CacheEntry fileCacheGetter( const std::string &fileName, size_t &cost )
 		throw IECore::Exception( "OpenImageIOReader : " + fileName + " : GafferImage does not support 3D pixel arrays " );
 	}
 
-	result.file.reset( new File( std::move( imageInput ), imageSpec, fileName ) );
+	result.file.reset( new File( std::move( imageInput ), imageSpec, fileName, key.resolutionLevel ) );
 
 	return result;
 }
 
-typedef LRUCache<std::string, CacheEntry> FileHandleCache;
+typedef LRUCache<std::string, CacheEntry, LRUCachePolicy::Parallel, FileHandleCacheGetterKey> FileHandleCache;
 
 FileHandleCache *fileCache()
 {
@@ -527,7 +1058,7 @@ FilePtr retrieveFile( std::string &fileName, OpenImageIOReader::MissingFrameMode
 	const std::string resolvedFileName = context->substitute( fileName );
 
 	FileHandleCache *cache = fileCache();
-	CacheEntry cacheEntry = cache->get( resolvedFileName );
+	CacheEntry cacheEntry = cache->get( FileHandleCacheGetterKey( resolvedFileName, ImagePlug::resolutionLevel( context ) ) );
 	if( !cacheEntry.file )
 	{
 		if( mode == OpenImageIOReader::Black )
@@ -571,6 +1102,95 @@ FilePtr retrieveFile( std::string &fileName, OpenImageIOReader::MissingFrameMode
 	return cacheEntry.file;
 }
 
+// Converts a tile stored by File::readTileBatch() into the float channel data
+// needed by ImagePlug.
+ConstFloatVectorDataPtr channelDataFromStorage( const Object *tile )
+{
+	TypeDesc format;
+	const void *data = nullptr;
+	size_t size = 0;
+	std::vector<unsigned char> decompressed;
+	switch( static_cast<IECore::TypeId>( tile->typeId() ) )
+	{
+		case FloatVectorDataTypeId :
+			if( static_cast<const FloatVectorData *>( tile )->readable().size() != 1 )
+			{
+				return static_cast<const FloatVectorData *>( tile );
+			}
+			format = TypeDesc::FLOAT;
+			data = static_cast<const FloatVectorData *>( tile )->baseReadable();
+			size = 1;
+			break;
+		case HalfVectorDataTypeId :
+			format = TypeDesc::HALF;
+			data = static_cast<const HalfVectorData *>( tile )->baseReadable();
+			size = static_cast<const HalfVectorData *>( tile )->readable().size();
+			break;
+		case UCharVectorDataTypeId :
+			format = TypeDesc::UINT8;
+			data = static_cast<const UCharVectorData *>( tile )->baseReadable();
+			size = static_cast<const UCharVectorData *>( tile )->readable().size();
+			break;
+		case UShortVectorDataTypeId :
+			format = TypeDesc::UINT16;
+			data = static_cast<const UShortVectorData *>( tile )->baseReadable();
+			size = static_cast<const UShortVectorData *>( tile )->readable().size();
+			break;
+		case CharVectorDataTypeId :
+			format = decompressTile( static_cast<const CharVectorData *>( tile ), decompressed );
+			data = decompressed.data();
+			size = decompressed.size() / format.size();
+			break;
+		default :
+			throw IECore::Exception( std::string( "OpenImageIOReader : Unexpected tile type " ) + tile->typeName() );
+	}
+
+	// We use OpenImageIO to do the conversion so that the results are
+	// identical to those we would get by asking it to read floats directly.
+	if( size == 1 )
+	{
+		// Constant tile. We return a shared tile, so that all the constant
+		// tiles with the same value occupy only one tile's worth of memory.
+		float value;
+		convert_types( format, data, TypeDesc::FLOAT, &value, 1 );
+		return ImagePlug::constantTile( value );
+	}
+
+	FloatVectorDataPtr result = new FloatVectorData;
+	std::vector<float> &resultSamples = result->writable();
+	resultSamples.resize( size );
+	convert_types( format, data, TypeDesc::FLOAT, resultSamples.data(), size );
+	return result;
+}
+
+// Returns the value of `tileBatchPlug` for the tile batch specified in the current context.
+ConstObjectVectorPtr tileBatch( const ObjectVectorPlug *tileBatchPlug, tbb::mutex &fileMutex )
+{
+	// We never want two threads to both read the same tile batch from disk, so it's important to lock
+	// on file->m_mutex before calling tileBatchPlug()->getValue().
+	//
+	// This however has the potential to create some serious performance hazards when the cache is contended
+	// by multiple threads trying to load different parts of the same image.  We can alleviate this using
+	// the temporary special purpose method getValueIfCached(), which allows us to immediately return if the
+	// value is already cached, without needing to acquire the lock.  In extreme cases, this can be a 10X
+	// speedup, because waiting on the lock when the data we need is in the cache could result in the data
+	// being evicted before we get to it.
+	//
+	// In the long run, we are hoping that we will be able to automatically make sure two threads never
+	// recompute the same plug value for any plug, and then all of this locking and short-circuiting will
+	// be unnecessary.
+	ConstObjectPtr tileBatchCached = tileBatchPlug->getValueIfCached();
+	if( tileBatchCached )
+	{
+		return IECore::runTimeCast< const ObjectVector >( tileBatchCached );
+	}
+
+	tbb::mutex::scoped_lock lock( fileMutex );
+	return tileBatchPlug->getValue();
+}
+
+std::atomic<int> g_prefetchConcurrency( 4 );
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////
@@ -598,7 +1218,9 @@ OpenImageIOReader::OpenImageIOReader( const std::string &name )
 	addChild( new ObjectVectorPlug( "__tileBatch", Plug::Out, new ObjectVector ) );
 
 	// disable caching on channelDataPlug, since it is just a redirect to the correct tile of
-	// the private tileBatchPlug, which is already being cached
+	// the private tileBatchPlug, which is already being cached. Tiles stored in a compact
+	// native format are converted to float on every access, but this is cheap relative to
+	// the memory we save by not caching them twice.
 	outPlug()->channelDataPlug()->setFlags( Plug::Cacheable, false );
 
 	plugSetSignal().connect( boost::bind( &OpenImageIOReader::plugSet, this, ::_1 ) );
@@ -776,6 +1398,8 @@ void OpenImageIOReader::hashFileName( const Gaffer::Context *context, IECore::Mu
 	{
 		h.append( context->getFrame() );
 	}
+	// Files are read at the resolution level specified by the context.
+	h.append( ImagePlug::resolutionLevel( context ) );
 }
 
 void OpenImageIOReader::hashFormat( const GafferImage::ImagePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
@@ -949,34 +1573,90 @@ IECore::ConstFloatVectorDataPtr OpenImageIOReader::computeChannelData( const std
 
 	c.set( g_tileBatchIndexContextName, tileBatchIndex );
 
-	ConstObjectVectorPtr tileBatch;
+	ConstObjectVectorPtr tileBatch = ::tileBatch( tileBatchPlug(), file->mutex() );
 
-	// We never want two threads to both read the same tile batch from disk, so it's important to lock
-	// on file->m_mutex before calling tileBatchPlug()->getValue().
-	//
-	// This however has the potential to create some serious performance hazards when the cache is contended
-	// by multiple threads trying to load different parts of the same image.  We can alleviate this using
-	// the temporary special purpose method getValueIfCached(), which allows us to immediately return if the
-	// value is already cached, without needing to acquire the lock.  In extreme cases, this can be a 10X
-	// speedup, because waiting on the lock when the data we need is in the cache could result in the data
-	// being evicted before we get to it.
-	//
-	// In the long run, we are hoping that we will be able to automatically make sure two threads never
-	// recompute the same plug value for any plug, and then all of this locking and short-circuiting will
-	// be unnecessary.
-	ConstObjectPtr tileBatchCached = tileBatchPlug()->getValueIfCached();
-	if( tileBatchCached )
+	return channelDataFromStorage( tileBatch->members()[ subIndex ].get() );
+}
+
+std::unique_ptr<Gaffer::BackgroundTask> OpenImageIOReader::prefetch( const std::vector<float> &frames ) const
+{
+	return ParallelAlgo::callOnBackgroundThread(
+		// Edits to the node will cancel the task before they are made, so it
+		// is safe for the task to reference `this`.
+		outPlug(),
+		[this, frames] {
+
+			const Context *context = Context::current();
+
+			// Reads are performed in a separate arena so that they occupy at most
+			// `g_prefetchConcurrency` threads, leaving the rest available for
+			// computation. Frames are dealt out individually so that they are
+			// started approximately in the order requested.
+			tbb::task_arena arena( g_prefetchConcurrency );
+			arena.execute(
+				[this, &frames, context] {
+					tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+					tbb::parallel_for(
+						tbb::blocked_range<size_t>( 0, frames.size(), 1 ),
+						[this, &frames, context] ( const tbb::blocked_range<size_t> &range ) {
+							for( size_t i = range.begin(); i != range.end(); ++i )
+							{
+								Context::EditableScope frameScope( context );
+								frameScope.setFrame( frames[i] );
+								prefetchFrame( Context::current() );
+							}
+						},
+						tbb::simple_partitioner(),
+						taskGroupContext
+					);
+				}
+			);
+
+		}
+	);
+}
+
+void OpenImageIOReader::setPrefetchConcurrency( int concurrency )
+{
+	g_prefetchConcurrency = std::max( concurrency, 1 );
+}
+
+int OpenImageIOReader::getPrefetchConcurrency()
+{
+	return g_prefetchConcurrency;
+}
+
+void OpenImageIOReader::setCacheCompression( bool compression )
+{
+	g_cacheCompression = compression;
+}
+
+bool OpenImageIOReader::getCacheCompression()
+{
+	return g_cacheCompression;
+}
+
+void OpenImageIOReader::prefetchFrame( const Gaffer::Context *context ) const
+{
+	IECore::Canceller::check( context->canceller() );
+
+	// Missing frames aren't an error when prefetching - they will
+	// be dealt with according to `missingFrameMode` when they are
+	// actually needed.
+	std::string fileName = fileNamePlug()->getValue();
+	FilePtr file = retrieveFile( fileName, Black, this, context );
+	if( !file )
 	{
-		tileBatch = IECore::runTimeCast< const ObjectVector >( tileBatchCached );
+		return;
 	}
-	else
+
+	Context::EditableScope tileBatchScope( context );
+	for( const auto &tileBatchIndex : file->tileBatchIndices() )
 	{
-		tbb::mutex::scoped_lock lock( file->mutex() );
-		tileBatch = tileBatchPlug()->getValue();
+		IECore::Canceller::check( context->canceller() );
+		tileBatchScope.set( g_tileBatchIndexContextName, tileBatchIndex );
+		::tileBatch( tileBatchPlug(), file->mutex() );
 	}
-
-	ConstObjectPtr curTileChannel = tileBatch->members()[ subIndex ];
-	return IECore::runTimeCast< const FloatVectorData >( curTileChannel );
 }
 
 void OpenImageIOReader::plugSet( Gaffer::Plug *plug )
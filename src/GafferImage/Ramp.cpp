@@ -231,6 +231,7 @@ void Ramp::hashChannelData( const GafferImage::ImagePlug *output, const Gaffer::
 
 	startPositionPlug()->hash( h );
 	endPositionPlug()->hash( h );
+	h.append( ImagePlug::resolutionLevel( context ) );
 }
 
 IECore::ConstFloatVectorDataPtr Ramp::computeChannelData( const std::string &channelName, const Imath::V2i &tileOrigin, const Gaffer::Context *context, const ImagePlug *parent ) const
@@ -239,7 +240,10 @@ IECore::ConstFloatVectorDataPtr Ramp::computeChannelData( const std::string &cha
 
 	const SplinefColor4f ramp = rampPlug()->getValue().spline();
 
-	const M33f inverseTransform = transformPlug()->matrix().inverse();
+	// The ramp is specified at full resolution, so we scale the transform
+	// to match the resolution level being computed.
+	const float resolutionScale = Format::resolutionScale( ImagePlug::resolutionLevel( context ) );
+	const M33f inverseTransform = ( transformPlug()->matrix() * M33f().scale( V2f( resolutionScale ) ) ).inverse();
 	const V2f startPosition = startPositionPlug()->getValue();
 	const V2f endPosition = endPositionPlug()->getValue();
 
@@ -36,12 +36,14 @@
 
 #include "GafferImage/RankFilter.h"
 
+#include "GafferImage/Format.h"
 #include "GafferImage/Sampler.h"
 
 #include "Gaffer/Context.h"
 
 #include <algorithm>
 #include <climits>
+#include <cmath>
 
 using namespace std;
 using namespace Imath;
@@ -49,6 +51,30 @@ using namespace IECore;
 using namespace Gaffer;
 using namespace GafferImage;
 
+namespace
+{
+
+// Returns the radius scaled to match the resolution level being computed.
+// We round up so that a non-zero radius never vanishes entirely at low
+// resolutions.
+V2i scaledRadius( const V2iPlug *radiusPlug, const Gaffer::Context *context )
+{
+	const V2i radius = radiusPlug->getValue();
+	const int level = ImagePlug::resolutionLevel( context );
+	if( !level )
+	{
+		return radius;
+	}
+
+	const float scale = Format::resolutionScale( level );
+	return V2i(
+		(int)ceilf( (float)radius.x * scale ),
+		(int)ceilf( (float)radius.y * scale )
+	);
+}
+
+} // namespace
+
 IE_CORE_DEFINERUNTIMETYPED( RankFilter );
 
 size_t RankFilter::g_firstPlugIndex = 0;
@@ -152,7 +178,7 @@ void RankFilter::affects( const Gaffer::Plug *input, AffectedPlugsContainer &out
 
 void RankFilter::hashDataWindow( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
-	const V2i radius = radiusPlug()->getValue();
+	const V2i radius = scaledRadius( radiusPlug(), context );
 	if( radius == V2i( 0 ) || !expandDataWindowPlug()->getValue() )
 	{
 		h = inPlug()->dataWindowPlug()->hash();
@@ -165,7 +191,7 @@ void RankFilter::hashDataWindow( const GafferImage::ImagePlug *parent, const Gaf
 
 Imath::Box2i RankFilter::computeDataWindow( const Gaffer::Context *context, const ImagePlug *parent ) const
 {
-	const V2i radius = radiusPlug()->getValue();
+	const V2i radius = scaledRadius( radiusPlug(), context );
 	if( radius == V2i( 0 ) || !expandDataWindowPlug()->getValue() )
 	{
 		return inPlug()->dataWindowPlug()->getValue();
@@ -185,7 +211,7 @@ void RankFilter::hash( const Gaffer::ValuePlug *output, const Gaffer::Context *c
 	ImageProcessor::hash( output, context, h );
 	if( output == pixelOffsetsPlug() )
 	{
-		const V2i radius = radiusPlug()->getValue();
+		const V2i radius = scaledRadius( radiusPlug(), context );
 		const V2i tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
 		const Box2i tileBound( tileOrigin, tileOrigin + V2i( ImagePlug::tileSize() ) );
 		const Box2i inputBound( tileBound.min - radius, tileBound.max + radius );
@@ -207,7 +233,7 @@ void RankFilter::compute( Gaffer::ValuePlug *output, const Gaffer::Context *cont
 {
 	if( output == pixelOffsetsPlug() )
 	{
-		const V2i radius = radiusPlug()->getValue();
+		const V2i radius = scaledRadius( radiusPlug(), context );
 		const V2i tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
 		const Box2i tileBound( tileOrigin, tileOrigin + V2i( ImagePlug::tileSize() ) );
 		const Box2i inputBound( tileBound.min - radius, tileBound.max + radius );
@@ -315,7 +341,7 @@ void RankFilter::compute( Gaffer::ValuePlug *output, const Gaffer::Context *cont
 
 void RankFilter::hashChannelData( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
-	const V2i radius = radiusPlug()->getValue();
+	const V2i radius = scaledRadius( radiusPlug(), context );
 	if( radius == V2i( 0 ) )
 	{
 		h = inPlug()->channelDataPlug()->hash();
@@ -351,7 +377,7 @@ void RankFilter::hashChannelData( const GafferImage::ImagePlug *parent, const Ga
 
 IECore::ConstFloatVectorDataPtr RankFilter::computeChannelData( const std::string &channelName, const Imath::V2i &tileOrigin, const Gaffer::Context *context, const ImagePlug *parent ) const
 {
-	const V2i radius = radiusPlug()->getValue();
+	const V2i radius = scaledRadius( radiusPlug(), context );
 	if( radius == V2i( 0 ) )
 	{
 		return inPlug()->channelDataPlug()->getValue();
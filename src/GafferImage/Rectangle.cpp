@@ -36,6 +36,8 @@
 
 #include "GafferImage/Rectangle.h"
 
+#include "GafferImage/Format.h"
+
 #include "Gaffer/Transform2DPlug.h"
 
 using namespace std;
@@ -51,6 +53,14 @@ using namespace GafferImage;
 namespace
 {
 
+// Returns the transform from the space of the rectangle into pixel
+// space at the resolution level being computed.
+M33f shapeTransform( const Transform2DPlug *transformPlug, const Gaffer::Context *context )
+{
+	const float resolutionScale = Format::resolutionScale( ImagePlug::resolutionLevel( context ) );
+	return transformPlug->matrix() * M33f().scale( V2f( resolutionScale ) );
+}
+
 // Rounds min down, and max up, while converting from float to int.
 Box2i box2fToBox2i( const Box2f &b )
 {
@@ -167,6 +177,7 @@ void Rectangle::hashShapeDataWindow( const Gaffer::Context *context, IECore::Mur
 	areaPlug()->hash( h );
 	lineWidthPlug()->hash( h );
 	transformPlug()->hash( h );
+	h.append( ImagePlug::resolutionLevel( context ) );
 }
 
 Imath::Box2i Rectangle::computeShapeDataWindow( const Gaffer::Context *context ) const
@@ -179,7 +190,7 @@ Imath::Box2i Rectangle::computeShapeDataWindow( const Gaffer::Context *context )
 	b.min -= V2f( lineWidth / 2.0f );
 	b.max += V2f( lineWidth / 2.0f );
 
-	b = transform( b, transformPlug()->matrix() );
+	b = transform( b, shapeTransform( transformPlug(), context ) );
 
 	return box2fToBox2i( b );
 }
@@ -208,6 +219,7 @@ void Rectangle::hashShapeChannelData( const Imath::V2i &tileOrigin, const Gaffer
 	lineWidthPlug()->hash( h );
 	cornerRadiusPlug()->hash( h );
 	transformPlug()->hash( h );
+	h.append( ImagePlug::resolutionLevel( context ) );
 }
 
 IECore::ConstFloatVectorDataPtr Rectangle::computeShapeChannelData(  const Imath::V2i &tileOrigin, const Gaffer::Context *context ) const
@@ -221,7 +233,7 @@ IECore::ConstFloatVectorDataPtr Rectangle::computeShapeChannelData(  const Imath
 
 	const float lineWidth = lineWidthPlug()->getValue();
 
-	const M33f transform = transformPlug()->matrix();
+	const M33f transform = shapeTransform( transformPlug(), context );
 	const M33f inverseTransform = transform.inverse();
 
 	float cornerRadius = cornerRadiusPlug()->getValue();
@@ -285,7 +285,14 @@ IECore::ConstFloatVectorDataPtr Shape::computeChannelData( const std::string &ch
 	if( channelName == g_shapeChannelName )
 	{
 		// Private channel we use for caching the shape but don't advertise via channelNames.
-		return computeShapeChannelData( tileOrigin, context );
+		// Tiles entirely inside or outside the shape are stored as shared constant tiles.
+		ConstFloatVectorDataPtr shape = computeShapeChannelData( tileOrigin, context );
+		float constantValue;
+		if( ImagePlug::isConstantTile( shape.get(), constantValue ) )
+		{
+			return ImagePlug::constantTile( constantValue );
+		}
+		return shape;
 	}
 	else
 	{
@@ -295,6 +302,12 @@ IECore::ConstFloatVectorDataPtr Shape::computeChannelData( const std::string &ch
 		{
 			return shape;
 		}
+
+		float constantValue;
+		if( ImagePlug::isConstantTile( shape.get(), constantValue ) )
+		{
+			return ImagePlug::constantTile( constantValue * c );
+		}
 		else
 		{
 			FloatVectorDataPtr resultData = shape->copy();
@@ -358,6 +358,7 @@ void Text::hashLayout( const Gaffer::Context *context, IECore::MurmurHash &h ) c
 	horizontalAlignmentPlug()->hash( h );
 	verticalAlignmentPlug()->hash( h );
 	transformPlug()->hash( h );
+	h.append( ImagePlug::resolutionLevel( context ) );
 }
 
 IECore::ConstCompoundObjectPtr Text::computeLayout( const Gaffer::Context *context ) const
@@ -373,12 +374,19 @@ IECore::ConstCompoundObjectPtr Text::computeLayout( const Gaffer::Context *conte
 	// and layout in the untransformed axis-aligned space specified by
 	// the area plug. We use FreeType's 26.6 fixed integer format for
 	// this stage, which measures in 64ths of a pixel. We store the layout
-	// in a vector of Lines made up of Words.
+	// in a vector of Lines made up of Words. This is always done at full
+	// resolution, so that word wrapping doesn't change with the resolution
+	// level.
 
 	Box2i area = areaPlug()->getValue();
 	if( BufferAlgo::empty( area ) )
 	{
+		// The input format is at the current resolution level,
+		// so we scale it back up to full resolution.
 		area = inPlug()->formatPlug()->getValue().getDisplayWindow();
+		const int levelScale = 1 << ImagePlug::resolutionLevel( context );
+		area.min *= levelScale;
+		area.max *= levelScale;
 	}
 
 	area.min *= 64; area.max *= 64;
@@ -462,7 +470,10 @@ IECore::ConstCompoundObjectPtr Text::computeLayout( const Gaffer::Context *conte
 
 	const HorizontalAlignment horizontalAlignment = (HorizontalAlignment)horizontalAlignmentPlug()->getValue();
 	const VerticalAlignment verticalAlignment = (VerticalAlignment)verticalAlignmentPlug()->getValue();
-	const M33f transform = transformPlug()->matrix();
+	// Scaling the transform to the resolution level also scales the glyphs,
+	// because FreeType renders them through it.
+	const float resolutionScale = Format::resolutionScale( ImagePlug::resolutionLevel( context ) );
+	const M33f transform = transformPlug()->matrix() * M33f().scale( V2f( resolutionScale ) );
 
 	float yOffset = 0;
 	if( verticalAlignment == Bottom )
@@ -57,7 +57,7 @@ using namespace GafferImage;
 struct VectorWarp::Engine : public Warp::Engine
 {
 
-	Engine( const Box2i &displayWindow, const Box2i &tileBound, const Box2i &validTileBound, ConstFloatVectorDataPtr xData, ConstFloatVectorDataPtr yData, ConstFloatVectorDataPtr aData, VectorMode vectorMode, VectorUnits vectorUnits )
+	Engine( const Box2i &displayWindow, const Box2i &tileBound, const Box2i &validTileBound, ConstFloatVectorDataPtr xData, ConstFloatVectorDataPtr yData, ConstFloatVectorDataPtr aData, VectorMode vectorMode, VectorUnits vectorUnits, float pixelScale )
 		:	m_displayWindow( displayWindow ),
 			m_tileBound( tileBound ),
 			m_xData( xData ),
@@ -67,7 +67,8 @@ struct VectorWarp::Engine : public Warp::Engine
 			m_y( yData->readable() ),
 			m_a( aData->readable() ),
 			m_vectorMode( vectorMode ),
-			m_vectorUnits( vectorUnits )
+			m_vectorUnits( vectorUnits ),
+			m_pixelScale( pixelScale )
 	{
 	}
 
@@ -85,7 +86,7 @@ struct VectorWarp::Engine : public Warp::Engine
 			
 			result += m_vectorUnits == Screen ?
 				screenToPixel( V2f( m_x[i], m_y[i] ) ) :
-				V2f( m_x[i], m_y[i] );
+				V2f( m_x[i], m_y[i] ) * m_pixelScale;
 
 			if( !std::isfinite( result[0] ) || !std::isfinite( result[1] ) )
 			{
@@ -119,6 +120,9 @@ struct VectorWarp::Engine : public Warp::Engine
 
 		const VectorMode m_vectorMode;
 		const VectorUnits m_vectorUnits;
+		// Vectors measured in pixels are specified at full resolution,
+		// so must be scaled to the resolution level being computed.
+		const float m_pixelScale;
 
 };
 
@@ -225,6 +229,7 @@ void VectorWarp::hashEngine( const Imath::V2i &tileOrigin, const Gaffer::Context
 
 	vectorModePlug()->hash( h );
 	vectorUnitsPlug()->hash( h );
+	h.append( ImagePlug::resolutionLevel( context ) );
 }
 
 const Warp::Engine *VectorWarp::computeEngine( const Imath::V2i &tileOrigin, const Gaffer::Context *context ) const
@@ -274,6 +279,7 @@ const Warp::Engine *VectorWarp::computeEngine( const Imath::V2i &tileOrigin, con
 		yData,
 		aData,
 		(VectorMode)vectorModePlug()->getValue(),
-		(VectorUnits)vectorUnitsPlug()->getValue()
+		(VectorUnits)vectorUnitsPlug()->getValue(),
+		Format::resolutionScale( ImagePlug::resolutionLevel( context ) )
 	);
 }
@@ -57,6 +57,10 @@ namespace
 	static IECore::InternedString g_pixelInputPositionsName( "pixelInputPositions"  );
 	static IECore::InternedString g_pixelInputDerivativesName( "pixelInputDerivatives"  );
 
+	// The largest input bound we will copy into a contiguous buffer
+	// in computeChannelData(), measured in pixels.
+	const int64_t g_maxNeighbourhoodPixels = 16 * ImagePlug::tileSize() * ImagePlug::tileSize();
+
 	const CompoundObject *sampleRegionsEmptyTile()
 	{
 		static ConstCompoundObjectPtr g_sampleRegionsEmptyTile( new CompoundObject() );
@@ -671,6 +675,19 @@ IECore::ConstFloatVectorDataPtr Warp::computeChannelData( const std::string &cha
 		(Sampler::BoundingMode)boundingModePlug()->getValue()
 	);
 
+	// The filter regions for neighbouring output pixels overlap heavily, so
+	// where the input bound is of modest size we copy it into a contiguous
+	// buffer up front, and filter directly from that. This avoids repeating
+	// the tile lookups and bounds checks for every input pixel of every filter
+	// region. Warps which scatter the tile across a large area of the input
+	// fall back to sampling on demand, to avoid fetching tiles we don't need.
+	std::vector<float> neighbourhood;
+	if( !BufferAlgo::empty( tileInputBound ) && (int64_t)tileInputBound.size().x * tileInputBound.size().y <= g_maxNeighbourhoodPixels )
+	{
+		neighbourhood.resize( tileInputBound.size().x * tileInputBound.size().y );
+		sampler.sampleRegion( tileInputBound, neighbourhood.data() );
+	}
+
 	std::vector<float> scratchMemory;
 	int i = 0;
 	V2i oP;
@@ -684,7 +701,14 @@ IECore::ConstFloatVectorDataPtr Warp::computeChannelData( const std::string &cha
 				const V2f &input = pixelInputPositions[i];
 				if( input != Engine::black )
 				{
-					v = FilterAlgo::sampleBox( sampler, input, pixelInputDerivatives[i].x, pixelInputDerivatives[i].y, filter, scratchMemory );
+					if( neighbourhood.size() )
+					{
+						v = FilterAlgo::sampleBox( neighbourhood.data(), tileInputBound, input, pixelInputDerivatives[i].x, pixelInputDerivatives[i].y, filter, scratchMemory );
+					}
+					else
+					{
+						v = FilterAlgo::sampleBox( sampler, input, pixelInputDerivatives[i].x, pixelInputDerivatives[i].y, filter, scratchMemory );
+					}
 				}
 			}
 			result.push_back( v );
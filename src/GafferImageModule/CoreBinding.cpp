@@ -171,6 +171,18 @@ class FormatPlugSerialiser : public GafferBindings::ValuePlugSerialiser
 
 };
 
+IECore::FloatVectorDataPtr sampleRegion( Sampler &sampler, const Imath::Box2i &region )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	IECore::FloatVectorDataPtr result = new IECore::FloatVectorData;
+	if( !BufferAlgo::empty( region ) )
+	{
+		result->writable().resize( region.size().x * region.size().y );
+		sampler.sampleRegion( region, result->writable().data() );
+	}
+	return result;
+}
+
 } // namespace
 
 void GafferImageModule::bindCore()
@@ -307,6 +319,7 @@ void GafferImageModule::bindCore()
 		.def( "hash", (void (Sampler::*)( IECore::MurmurHash & ) const)&Sampler::hash )
 		.def( "sample", (float (Sampler::*)( float, float ) )&Sampler::sample )
 		.def( "sample", (float (Sampler::*)( int, int ) )&Sampler::sample )
+		.def( "sampleRegion", &sampleRegion )
 	;
 
 }
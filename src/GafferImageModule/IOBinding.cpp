@@ -49,6 +49,10 @@
 
 #include "GafferBindings/DependencyNodeBinding.h"
 
+#include "Gaffer/BackgroundTask.h"
+
+#include "boost/python/suite/indexing/container_utils.hpp"
+
 using namespace std;
 using namespace boost::python;
 using namespace Gaffer;
@@ -111,6 +115,25 @@ boost::python::list supportedExtensions()
 	return result;
 }
 
+template<typename T>
+std::shared_ptr<BackgroundTask> prefetch( const T &reader, object pythonFrames )
+{
+	std::vector<float> frames;
+	boost::python::container_utils::extend_container( frames, pythonFrames );
+
+	std::unique_ptr<BackgroundTask> backgroundTask = reader.prefetch( frames );
+	return std::shared_ptr<BackgroundTask>(
+		backgroundTask.release(),
+		// Custom deleter. The destructor waits for the
+		// background task, so we release the GIL while
+		// it does.
+		[]( BackgroundTask *t ) {
+			IECorePython::ScopedGILRelease gilRelease;
+			delete t;
+		}
+	);
+}
+
 } // namespace
 
 void GafferImageModule::bindIO()
@@ -127,6 +150,15 @@ void GafferImageModule::bindIO()
 		scope s = GafferBindings::DependencyNodeClass<OpenImageIOReader>()
 			.def( "supportedExtensions", &supportedExtensions<OpenImageIOReader> )
 			.staticmethod( "supportedExtensions" )
+			.def( "prefetch", &prefetch<OpenImageIOReader> )
+			.def( "setPrefetchConcurrency", &OpenImageIOReader::setPrefetchConcurrency )
+			.staticmethod( "setPrefetchConcurrency" )
+			.def( "getPrefetchConcurrency", &OpenImageIOReader::getPrefetchConcurrency )
+			.staticmethod( "getPrefetchConcurrency" )
+			.def( "setCacheCompression", &OpenImageIOReader::setCacheCompression )
+			.staticmethod( "setCacheCompression" )
+			.def( "getCacheCompression", &OpenImageIOReader::getCacheCompression )
+			.staticmethod( "getCacheCompression" )
 		;
 
 		enum_<OpenImageIOReader::MissingFrameMode>( "MissingFrameMode" )
@@ -140,6 +172,7 @@ void GafferImageModule::bindIO()
 		scope s = GafferBindings::DependencyNodeClass<ImageReader>()
 			.def( "supportedExtensions", &supportedExtensions<ImageReader> )
 			.staticmethod( "supportedExtensions" )
+			.def( "prefetch", &prefetch<ImageReader> )
 			.def( "setDefaultColorSpaceFunction", &setDefaultColorSpaceFunction<ImageReader> )
 			.staticmethod( "setDefaultColorSpaceFunction" )
 			.def( "getDefaultColorSpaceFunction", &getDefaultColorSpaceFunction<ImageReader> )
@@ -58,6 +58,9 @@
 #include "boost/bind.hpp"
 #include "boost/lexical_cast.hpp"
 
+#include "tbb/pipeline.h"
+#include "tbb/task_scheduler_init.h"
+
 using namespace std;
 using namespace boost;
 using namespace Imath;
@@ -88,6 +91,7 @@ ImageGadget::ImageGadget()
 	setContext( new Context() );
 
 	visibilityChangedSignal().connect( boost::bind( &ImageGadget::visibilityChanged, this ) );
+	parentChangedSignal().connect( boost::bind( &ImageGadget::parentChanged, this ) );
 }
 
 ImageGadget::~ImageGadget()
@@ -452,7 +456,7 @@ void ImageGadget::Tile::applyUpdates( const std::vector<Update> &updates )
 	}
 }
 
-const IECoreGL::Texture *ImageGadget::Tile::texture( bool &active )
+const IECoreGL::Texture *ImageGadget::Tile::texture( bool &active, size_t &uploadBudget )
 {
 	const auto now = std::chrono::steady_clock::now();
 	Mutex::scoped_lock lock( m_mutex );
@@ -463,12 +467,17 @@ const IECoreGL::Texture *ImageGadget::Tile::texture( bool &active )
 		active = true;
 	}
 
-	ConstFloatVectorDataPtr channelDataToConvert = m_channelDataToConvert;
-	m_channelDataToConvert = nullptr;
+	ConstFloatVectorDataPtr channelDataToConvert;
+	if( uploadBudget )
+	{
+		channelDataToConvert = m_channelDataToConvert;
+		m_channelDataToConvert = nullptr;
+	}
 	lock.release(); // Don't hold lock while doing expensive conversion
 
 	if( channelDataToConvert )
 	{
+		uploadBudget--;
 		GLuint texture;
 		glGenTextures( 1, &texture );
 		m_texture = new Texture( texture ); // Lock not needed, because this is only touched on the UI thread.
@@ -539,6 +548,19 @@ void ImageGadget::updateTiles()
 	}
 
 	const Box2i dataWindow = this->dataWindow();
+	vector<V2i> tileOrigins;
+	if( !BufferAlgo::empty( dataWindow ) )
+	{
+		const V2i minTileOrigin = ImagePlug::tileOrigin( dataWindow.min );
+		const V2i maxTileOrigin = ImagePlug::tileOrigin( dataWindow.max - V2i( 1 ) );
+		for( V2i tileOrigin = minTileOrigin; tileOrigin.y <= maxTileOrigin.y; tileOrigin.y += ImagePlug::tileSize() )
+		{
+			for( tileOrigin.x = minTileOrigin.x; tileOrigin.x <= maxTileOrigin.x; tileOrigin.x += ImagePlug::tileSize() )
+			{
+				tileOrigins.push_back( tileOrigin );
+			}
+		}
+	}
 
 	// Do the actual work of generating the tiles asynchronously,
 	// in the background.
@@ -555,18 +577,7 @@ void ImageGadget::updateTiles()
 		}
 
 		Tile::applyUpdates( updates );
-
-		if( refCount() && !m_renderRequestPending.exchange( true ) )
-		{
-			// Must hold a reference to stop us dying before our UI thread call is scheduled.
-			ImageGadgetPtr thisRef = this;
-			ParallelAlgo::callOnUIThread(
-				[thisRef] {
-					thisRef->m_renderRequestPending = false;
-					thisRef->requestRender();
-				}
-			);
-		}
+		scheduleRenderRequest();
 	};
 
 	Context::Scope scopedContext( m_context.get() );
@@ -575,8 +586,64 @@ void ImageGadget::updateTiles()
 		m_image.get(),
 		// OK to capture `this` via raw pointer, because ~ImageGadget waits for
 		// the background process to complete.
-		[this, channelsToCompute, dataWindow, tileFunctor] {
-			ImageAlgo::parallelProcessTiles( m_image.get(), tileFunctor, dataWindow );
+		[this, tileOrigins, tileFunctor] () mutable {
+
+			// Sort the tiles so that the highest priority tile is at the
+			// back, where it can be removed cheaply. We only sort again
+			// if the priority changes while we work, for instance because
+			// the cursor has moved.
+			auto sortTiles = [&tileOrigins] ( const TilePriority &priority ) {
+				std::sort(
+					tileOrigins.begin(), tileOrigins.end(),
+					[&priority] ( const V2i &a, const V2i &b ) {
+						return priority.key( b ) < priority.key( a );
+					}
+				);
+			};
+
+			TilePriority sortedPriority = tilePriority();
+			sortTiles( sortedPriority );
+
+			const Context *context = Context::current();
+			tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+			tbb::parallel_pipeline(
+
+				tbb::task_scheduler_init::default_num_threads(),
+
+				tbb::make_filter<void, V2i>(
+					tbb::filter::serial,
+					[this, &tileOrigins, &sortTiles, &sortedPriority] ( tbb::flow_control &fc ) {
+						if( tileOrigins.empty() )
+						{
+							fc.stop();
+							return V2i( 0 );
+						}
+						const TilePriority priority = tilePriority();
+						if( priority.visibleWindow != sortedPriority.visibleWindow || priority.position != sortedPriority.position )
+						{
+							sortTiles( priority );
+							sortedPriority = priority;
+						}
+						const V2i result = tileOrigins.back();
+						tileOrigins.pop_back();
+						return result;
+					}
+				) &
+
+				tbb::make_filter<V2i, void>(
+					tbb::filter::parallel,
+					[this, &tileFunctor, context] ( const V2i &tileOrigin ) {
+						ImagePlug::ChannelDataScope channelDataScope( context );
+						channelDataScope.setTileOrigin( tileOrigin );
+						tileFunctor( m_image.get(), tileOrigin );
+					}
+				),
+
+				// Prevents outer tasks silently cancelling our tasks
+				taskGroupContext
+
+			);
+
 			m_dirtyFlags &= ~TilesDirty;
 			if( refCount() )
 			{
@@ -592,6 +659,107 @@ void ImageGadget::updateTiles()
 
 }
 
+void ImageGadget::scheduleRenderRequest()
+{
+	if( refCount() && !m_renderRequestPending.exchange( true ) )
+	{
+		// Must hold a reference to stop us dying before our UI thread call is scheduled.
+		ImageGadgetPtr thisRef = this;
+		ParallelAlgo::callOnUIThread(
+			[thisRef] {
+				thisRef->m_renderRequestPending = false;
+				thisRef->requestRender();
+			}
+		);
+	}
+}
+
+std::pair<bool, float> ImageGadget::TilePriority::key( const Imath::V2i &tileOrigin ) const
+{
+	const Box2i tileBound( tileOrigin, tileOrigin + V2i( ImagePlug::tileSize() ) );
+	const V2f tileCenter = V2f( tileOrigin ) + V2f( ImagePlug::tileSize() / 2.0f );
+	return std::make_pair(
+		!BufferAlgo::intersects( visibleWindow, tileBound ),
+		( tileCenter - position ).length2()
+	);
+}
+
+void ImageGadget::updateTilePriority() const
+{
+	TilePriority priority;
+	const ViewportGadget *viewport = ancestor<ViewportGadget>();
+	if( viewport )
+	{
+		Box2f visibleBound;
+		visibleBound.extendBy( pixelAt( viewport->rasterToGadgetSpace( V2f( 0 ), this ) ) );
+		visibleBound.extendBy( pixelAt( viewport->rasterToGadgetSpace( V2f( viewport->getViewport() ), this ) ) );
+		priority.visibleWindow = Box2i(
+			V2i( (int)floorf( visibleBound.min.x ), (int)floorf( visibleBound.min.y ) ),
+			V2i( (int)ceilf( visibleBound.max.x ), (int)ceilf( visibleBound.max.y ) )
+		);
+		priority.position = m_cursorPosition ? pixelAt( viewport->rasterToGadgetSpace( *m_cursorPosition, this ) ) : visibleBound.center();
+	}
+	else
+	{
+		priority.visibleWindow = dataWindow();
+		priority.position = V2f( priority.visibleWindow.center() );
+	}
+
+	TilePriorityMutex::scoped_lock lock( m_tilePriorityMutex );
+	m_tilePriority = priority;
+}
+
+ImageGadget::TilePriority ImageGadget::tilePriority() const
+{
+	TilePriorityMutex::scoped_lock lock( m_tilePriorityMutex );
+	return m_tilePriority;
+}
+
+void ImageGadget::parentChanged()
+{
+	m_cursorPosition = boost::none;
+	if( ViewportGadget *viewport = ancestor<ViewportGadget>() )
+	{
+		// Connect at front, so that we see events even when
+		// they are handled by another slot.
+		m_viewportMouseMoveConnection = viewport->mouseMoveSignal().connect(
+			boost::bind( &ImageGadget::viewportMouseMove, this, ::_2 ), boost::signals::at_front
+		);
+		m_viewportLeaveConnection = viewport->leaveSignal().connect(
+			boost::bind( &ImageGadget::viewportLeave, this )
+		);
+	}
+	else
+	{
+		m_viewportMouseMoveConnection.disconnect();
+		m_viewportLeaveConnection.disconnect();
+	}
+}
+
+bool ImageGadget::viewportMouseMove( const GafferUI::ButtonEvent &event )
+{
+	// Viewport events are in raster space.
+	m_cursorPosition = V2f( event.line.p0.x, event.line.p0.y );
+	if( m_tilesTask )
+	{
+		try
+		{
+			updateTilePriority();
+		}
+		catch( ... )
+		{
+			// Errors computing the format will be
+			// reported by the next render.
+		}
+	}
+	return false;
+}
+
+void ImageGadget::viewportLeave()
+{
+	m_cursorPosition = boost::none;
+}
+
 void ImageGadget::removeOutOfBoundsTiles() const
 {
 	// In theory, any given tile we hold could turn out to be valid
@@ -694,6 +862,11 @@ const std::string &fragmentSource()
 	return g_fragmentSource;
 }
 
+// Limits the number of textures uploaded by each render, so that
+// the UI remains responsive while large numbers of tiles arrive.
+// Remaining textures are uploaded by subsequent renders.
+const size_t g_maxTextureUploadsPerRender = 256;
+
 IECoreGL::Shader *shader()
 {
 	static IECoreGL::ShaderPtr g_shader;
@@ -745,10 +918,15 @@ void ImageGadget::renderTiles() const
 	const Box2i dataWindow = this->dataWindow();
 	const float pixelAspect = this->format().getPixelAspect();
 
-	V2i tileOrigin = ImagePlug::tileOrigin( dataWindow.min );
-	for( ; tileOrigin.y < dataWindow.max.y; tileOrigin.y += ImagePlug::tileSize() )
+	// Only draw the tiles that are visible, so that we don't spend
+	// our upload budget on textures that won't be seen.
+	const Box2i renderWindow = BufferAlgo::intersection( dataWindow, m_tilePriority.visibleWindow );
+	size_t uploadBudget = g_maxTextureUploadsPerRender;
+
+	V2i tileOrigin = ImagePlug::tileOrigin( renderWindow.min );
+	for( ; tileOrigin.y < renderWindow.max.y; tileOrigin.y += ImagePlug::tileSize() )
 	{
-		for( tileOrigin.x = ImagePlug::tileOrigin( dataWindow.min ).x; tileOrigin.x < dataWindow.max.x; tileOrigin.x += ImagePlug::tileSize() )
+		for( tileOrigin.x = ImagePlug::tileOrigin( renderWindow.min ).x; tileOrigin.x < renderWindow.max.x; tileOrigin.x += ImagePlug::tileSize() )
 		{
 			bool active = false;
 			for( int i = 0; i < 4; ++i )
@@ -758,7 +936,7 @@ void ImageGadget::renderTiles() const
 				Tiles::const_iterator it = m_tiles.find( TileIndex( tileOrigin, channelName ) );
 				if( it != m_tiles.end() )
 				{
-					it->second.texture( active )->bind();
+					it->second.texture( active, uploadBudget )->bind();
 				}
 				else
 				{
@@ -801,6 +979,13 @@ void ImageGadget::renderTiles() const
 	}
 
 	glUseProgram( previousProgram );
+
+	if( !uploadBudget )
+	{
+		// There may be more textures waiting to be uploaded, so
+		// schedule another render to pick them up.
+		const_cast<ImageGadget *>( this )->scheduleRenderRequest();
+	}
 }
 
 void ImageGadget::renderText( const std::string &text, const Imath::V2f &position, const Imath::V2f &alignment, const GafferUI::Style *style ) const
@@ -841,6 +1026,7 @@ void ImageGadget::doRenderLayer( Layer layer, const GafferUI::Style *style ) con
 	{
 		format = this->format();
 		dataWindow = this->dataWindow();
+		updateTilePriority();
 		const_cast<ImageGadget *>( this )->updateTiles();
 	}
 	catch( ... )
@@ -0,0 +1,292 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2026, Image Engine Design Inc. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "GafferScene/CameraVisibilityProcessor.h"
+
+#include "GafferScene/RendererAlgo.h"
+#include "GafferScene/SceneAlgo.h"
+
+#include "Gaffer/StringPlug.h"
+
+#include "IECoreScene/Camera.h"
+
+#include "IECore/ObjectVector.h"
+#include "IECore/VectorTypedData.h"
+
+using namespace std;
+using namespace Imath;
+using namespace IECore;
+using namespace IECoreScene;
+using namespace Gaffer;
+using namespace GafferScene;
+
+//////////////////////////////////////////////////////////////////////////
+// Internal utilities
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+const InternedString g_cameraOptionName( "option:render:camera" );
+const InternedString g_visibleAttributeName( "scene:visible" );
+
+// Returns the times at which to sample the camera.
+vector<float> sampleTimes( const CompoundObject *globals, const ScenePlug *scene )
+{
+	const V2f shutter = SceneAlgo::shutter( globals, scene );
+	vector<float> result( 1, shutter[0] );
+	if( shutter[1] != shutter[0] )
+	{
+		result.push_back( shutter[1] );
+	}
+	return result;
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// CameraVisibilityProcessor
+//////////////////////////////////////////////////////////////////////////
+
+IE_CORE_DEFINERUNTIMETYPED( CameraVisibilityProcessor );
+
+const IECore::InternedString CameraVisibilityProcessor::camerasName( "cameras" );
+const IECore::InternedString CameraVisibilityProcessor::worldToCameraName( "worldToCamera" );
+const IECore::InternedString CameraVisibilityProcessor::timesName( "times" );
+
+size_t CameraVisibilityProcessor::g_firstPlugIndex = 0;
+
+CameraVisibilityProcessor::CameraVisibilityProcessor( const std::string &name )
+	:	FilteredSceneProcessor( name, IECore::PathMatcher::NoMatch )
+{
+	storeIndexOfNextChild( g_firstPlugIndex );
+	addChild( new StringPlug( "camera" ) );
+	addChild( new ObjectPlug( "__cameraSamples", Plug::Out, new CompoundObject ) );
+
+	// Direct pass-throughs
+	outPlug()->boundPlug()->setInput( inPlug()->boundPlug() );
+	outPlug()->transformPlug()->setInput( inPlug()->transformPlug() );
+	outPlug()->objectPlug()->setInput( inPlug()->objectPlug() );
+	outPlug()->childNamesPlug()->setInput( inPlug()->childNamesPlug() );
+	outPlug()->globalsPlug()->setInput( inPlug()->globalsPlug() );
+	outPlug()->setNamesPlug()->setInput( inPlug()->setNamesPlug() );
+	outPlug()->setPlug()->setInput( inPlug()->setPlug() );
+}
+
+CameraVisibilityProcessor::~CameraVisibilityProcessor()
+{
+}
+
+Gaffer::StringPlug *CameraVisibilityProcessor::cameraPlug()
+{
+	return getChild<StringPlug>( g_firstPlugIndex );
+}
+
+const Gaffer::StringPlug *CameraVisibilityProcessor::cameraPlug() const
+{
+	return getChild<StringPlug>( g_firstPlugIndex );
+}
+
+Gaffer::ObjectPlug *CameraVisibilityProcessor::cameraSamplesPlug()
+{
+	return getChild<ObjectPlug>( g_firstPlugIndex + 1 );
+}
+
+const Gaffer::ObjectPlug *CameraVisibilityProcessor::cameraSamplesPlug() const
+{
+	return getChild<ObjectPlug>( g_firstPlugIndex + 1 );
+}
+
+void CameraVisibilityProcessor::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const
+{
+	FilteredSceneProcessor::affects( input, outputs );
+
+	if(
+		input == cameraPlug() ||
+		input == inPlug()->globalsPlug() ||
+		input == inPlug()->childNamesPlug() ||
+		input == inPlug()->transformPlug() ||
+		input == inPlug()->objectPlug()
+	)
+	{
+		outputs.push_back( cameraSamplesPlug() );
+	}
+
+	// Derived classes typically measure the bounds and transforms
+	// of locations against the camera.
+	if(
+		input == filterPlug() ||
+		input == cameraSamplesPlug() ||
+		input == inPlug()->attributesPlug() ||
+		input == inPlug()->boundPlug() ||
+		input == inPlug()->transformPlug() ||
+		input == inPlug()->childNamesPlug()
+	)
+	{
+		outputs.push_back( outPlug()->attributesPlug() );
+	}
+}
+
+IECore::ConstCompoundObjectPtr CameraVisibilityProcessor::cameraSamples() const
+{
+	ScenePlug::GlobalScope globalScope( Context::current() );
+	return boost::static_pointer_cast<const CompoundObject>( cameraSamplesPlug()->getValue() );
+}
+
+bool CameraVisibilityProcessor::cameraPath( const IECore::CompoundObject *globals, ScenePath &path ) const
+{
+	string cameraName = cameraPlug()->getValue();
+	if( cameraName.empty() )
+	{
+		if( const StringData *cameraOption = globals->member<StringData>( g_cameraOptionName ) )
+		{
+			cameraName = cameraOption->readable();
+		}
+	}
+
+	if( cameraName.empty() )
+	{
+		return false;
+	}
+
+	ScenePlug::stringToPath( cameraName, path );
+	return SceneAlgo::exists( inPlug(), path );
+}
+
+void CameraVisibilityProcessor::hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
+{
+	FilteredSceneProcessor::hash( output, context, h );
+
+	if( output == cameraSamplesPlug() )
+	{
+		ConstCompoundObjectPtr globals = inPlug()->globalsPlug()->getValue();
+		ScenePath cameraPath;
+		if( !this->cameraPath( globals.get(), cameraPath ) )
+		{
+			return;
+		}
+
+		inPlug()->globalsPlug()->hash( h );
+		h.append( cameraPath.data(), cameraPath.size() );
+
+		Context::EditableScope timeScope( context );
+		for( float time : sampleTimes( globals.get(), inPlug() ) )
+		{
+			timeScope.setFrame( time );
+			h.append( time );
+			h.append( inPlug()->objectHash( cameraPath ) );
+			h.append( inPlug()->fullTransformHash( cameraPath ) );
+		}
+	}
+}
+
+void CameraVisibilityProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const
+{
+	if( output == cameraSamplesPlug() )
+	{
+		CompoundObjectPtr result = new CompoundObject;
+		ObjectVectorPtr cameras = new ObjectVector;
+		M44fVectorDataPtr worldToCamera = new M44fVectorData;
+		FloatVectorDataPtr times = new FloatVectorData;
+		result->members()[camerasName] = cameras;
+		result->members()[worldToCameraName] = worldToCamera;
+		result->members()[timesName] = times;
+
+		ConstCompoundObjectPtr globals = inPlug()->globalsPlug()->getValue();
+		ScenePath cameraPath;
+		if( this->cameraPath( globals.get(), cameraPath ) )
+		{
+			Context::EditableScope timeScope( context );
+			for( float time : sampleTimes( globals.get(), inPlug() ) )
+			{
+				timeScope.setFrame( time );
+
+				ConstCameraPtr constCamera = runTimeCast<const Camera>( inPlug()->object( cameraPath ) );
+				if( !constCamera )
+				{
+					// Not a camera, so treat it as if there is no camera at all.
+					cameras->members().clear();
+					worldToCamera->writable().clear();
+					times->writable().clear();
+					break;
+				}
+
+				CameraPtr camera = constCamera->copy();
+				RendererAlgo::applyCameraGlobals( camera.get(), globals.get(), inPlug() );
+
+				cameras->members().push_back( camera );
+				worldToCamera->writable().push_back( inPlug()->fullTransform( cameraPath ).inverse() );
+				times->writable().push_back( time );
+			}
+		}
+
+		static_cast<ObjectPlug *>( output )->setValue( result );
+		return;
+	}
+
+	FilteredSceneProcessor::compute( output, context );
+}
+
+void CameraVisibilityProcessor::hashAttributes( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
+{
+	// The decision is cheap compared to the downstream cost of
+	// rendering a location which should have been hidden, so we
+	// make it here, allowing the hash to pass through for visible
+	// locations.
+	if( !hidden( path ) )
+	{
+		h = inPlug()->attributesPlug()->hash();
+		return;
+	}
+
+	FilteredSceneProcessor::hashAttributes( path, context, parent, h );
+	inPlug()->attributesPlug()->hash( h );
+}
+
+IECore::ConstCompoundObjectPtr CameraVisibilityProcessor::computeAttributes( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent ) const
+{
+	ConstCompoundObjectPtr inputAttributes = inPlug()->attributesPlug()->getValue();
+	if( !hidden( path ) )
+	{
+		return inputAttributes;
+	}
+
+	CompoundObjectPtr result = new CompoundObject;
+	result->members() = inputAttributes->members();
+	result->members()[g_visibleAttributeName] = new BoolData( false );
+
+	return result;
+}
@@ -41,15 +41,123 @@
 
 #include "Gaffer/Node.h"
 
+#include "IECore/LRUCache.h"
 #include "IECore/MessageHandler.h"
 
+#include "boost/algorithm/string/predicate.hpp"
 #include "boost/bind.hpp"
 
+#include <memory>
+#include <vector>
+
 using namespace IECore;
 using namespace IECoreScene;
 using namespace Gaffer;
 using namespace GafferScene;
 
+//////////////////////////////////////////////////////////////////////////
+// Internal utilities
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Expanding a capsule requires the globals and the render sets,
+// which are the same for every capsule in a typical render. We
+// cache them so that they are computed once, rather than once for
+// each of the potentially many thousands of capsules being expanded.
+
+struct RenderState : boost::noncopyable
+{
+
+	RenderState( const ScenePlug *scene )
+		:	globals( scene->globalsPlug()->getValue() ), renderSets( scene )
+	{
+	}
+
+	const IECore::ConstCompoundObjectPtr globals;
+	const RendererAlgo::RenderSets renderSets;
+
+};
+
+typedef std::shared_ptr<const RenderState> ConstRenderStatePtr;
+
+const InternedString g_camerasSetName( "__cameras" );
+const InternedString g_lightsSetName( "__lights" );
+const std::string g_renderSetsPrefix( "render:" );
+
+struct RenderStateCacheGetterKey
+{
+
+	// Hashes everything read by the RenderState constructor. The
+	// hashes are much cheaper to compute than the sets themselves.
+	// The set names must be hashed too, because a set's hash doesn't
+	// necessarily depend on its name, so renaming a set may leave
+	// all the set hashes unchanged.
+	RenderStateCacheGetterKey( const ScenePlug *scene )
+		:	scene( scene )
+	{
+		scene->globalsPlug()->hash( hash );
+		scene->setNamesPlug()->hash( hash );
+		ConstInternedStringVectorDataPtr setNamesData = scene->setNamesPlug()->getValue();
+
+		setNames.push_back( g_camerasSetName );
+		setNames.push_back( g_lightsSetName );
+		for( const auto &setName : setNamesData->readable() )
+		{
+			if( boost::starts_with( setName.string(), g_renderSetsPrefix ) )
+			{
+				setNames.push_back( setName );
+			}
+		}
+
+		ScenePlug::SetScope setScope( Context::current() );
+		for( const auto &setName : setNames )
+		{
+			setScope.setSetName( setName );
+			scene->setPlug()->hash( hash );
+		}
+	}
+
+	operator const IECore::MurmurHash & () const
+	{
+		return hash;
+	}
+
+	IECore::MurmurHash hash;
+	const ScenePlug *scene;
+	std::vector<IECore::InternedString> setNames;
+
+};
+
+ConstRenderStatePtr renderStateGetter( const RenderStateCacheGetterKey &key, size_t &cost )
+{
+	ConstRenderStatePtr result = std::make_shared<RenderState>( key.scene );
+
+	// The sets have just been computed by the RenderState, so they
+	// are cheap to retrieve from the compute cache to measure them.
+	cost = result->globals->memoryUsage();
+	ScenePlug::SetScope setScope( Context::current() );
+	for( const auto &setName : key.setNames )
+	{
+		setScope.setSetName( setName );
+		cost += key.scene->setPlug()->getValue()->memoryUsage();
+	}
+
+	return result;
+}
+
+typedef LRUCache<IECore::MurmurHash, ConstRenderStatePtr, LRUCachePolicy::Parallel, RenderStateCacheGetterKey> RenderStateCache;
+// Limited by memory rather than by the number of entries, since the
+// sets for a large scene may be very large.
+RenderStateCache g_renderStateCache( renderStateGetter, 1024 * 1024 * 1024 );
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// Capsule
+//////////////////////////////////////////////////////////////////////////
+
 IE_CORE_DEFINEOBJECTTYPEDESCRIPTION( Capsule );
 
 Capsule::Capsule()
@@ -169,10 +277,18 @@ Imath::Box3f Capsule::bound() const
 void Capsule::render( IECoreScenePreview::Renderer *renderer ) const
 {
 	throwIfExpired();
-	IECore::ConstCompoundObjectPtr globals = m_scene->globalsPlug()->getValue();
-	RendererAlgo::RenderSets renderSets( m_scene );
+
+	// Our context contains the path of the location we were computed
+	// for, so we must remove it for the render state to be shared
+	// between capsules.
+	ConstRenderStatePtr renderState;
+	{
+		ScenePlug::GlobalScope globalScope( m_context.get() );
+		renderState = g_renderStateCache.get( RenderStateCacheGetterKey( m_scene ) );
+	}
+
 	Context::Scope scope( m_context.get() );
-	RendererAlgo::outputObjects( m_scene, globals.get(), renderSets, renderer, m_root );
+	RendererAlgo::outputObjects( m_scene, renderState->globals.get(), renderState->renderSets, renderer, m_root );
 }
 
 const ScenePlug *Capsule::scene() const
@@ -90,6 +90,11 @@ void Filter::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs
 	}
 }
 
+bool Filter::knownMatches( IECore::PathMatcher &paths ) const
+{
+	return false;
+}
+
 bool Filter::sceneAffectsMatch( const ScenePlug *scene, const Gaffer::ValuePlug *child ) const
 {
 	return false;
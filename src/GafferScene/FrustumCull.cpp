@@ -0,0 +1,261 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2026, Image Engine Design Inc. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "GafferScene/FrustumCull.h"
+
+#include "IECoreScene/Camera.h"
+
+#include "IECore/ObjectVector.h"
+#include "IECore/VectorTypedData.h"
+
+using namespace std;
+using namespace Imath;
+using namespace IECore;
+using namespace IECoreScene;
+using namespace Gaffer;
+using namespace GafferScene;
+
+//////////////////////////////////////////////////////////////////////////
+// Internal utilities
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+const InternedString g_lightsSetName( "__lights" );
+const InternedString g_camerasSetName( "__cameras" );
+
+// Returns true if `bound` lies entirely outside the frustum of `camera`.
+// The screen window is expanded to account for overscan and `padding`.
+bool outside( const Box3f &bound, const M44f &objectToCamera, const Camera *camera, float padding )
+{
+	if( bound.isEmpty() )
+	{
+		return false;
+	}
+
+	Box2f screenWindow = camera->hasResolution() ? camera->frustum() : camera->frustum( Camera::Distort );
+	const V2f size = screenWindow.size();
+	if( camera->getOverscan() )
+	{
+		screenWindow.min.x -= size.x * camera->getOverscanLeft();
+		screenWindow.max.x += size.x * camera->getOverscanRight();
+		screenWindow.min.y -= size.y * camera->getOverscanBottom();
+		screenWindow.max.y += size.y * camera->getOverscanTop();
+	}
+	screenWindow.min -= size * padding;
+	screenWindow.max += size * padding;
+
+	const bool perspective = camera->getProjection() == "perspective";
+	const V2f clippingPlanes = camera->getClippingPlanes();
+
+	// Classify each corner of the bound against the planes
+	// of the frustum. The bound is outside if all its corners
+	// are on the outside of any single plane.
+	unsigned outsideAll = ~0u;
+	for( int i = 0; i < 8; ++i )
+	{
+		const V3f corner(
+			i & 1 ? bound.max.x : bound.min.x,
+			i & 2 ? bound.max.y : bound.min.y,
+			i & 4 ? bound.max.z : bound.min.z
+		);
+		const V3f p = corner * objectToCamera;
+		const float depth = -p.z;
+		const float scale = perspective ? depth : 1.0f;
+
+		unsigned outsideCorner = 0;
+		outsideCorner |= p.x < screenWindow.min.x * scale ? 1 : 0;
+		outsideCorner |= p.x > screenWindow.max.x * scale ? 2 : 0;
+		outsideCorner |= p.y < screenWindow.min.y * scale ? 4 : 0;
+		outsideCorner |= p.y > screenWindow.max.y * scale ? 8 : 0;
+		outsideCorner |= depth < clippingPlanes[0] ? 16 : 0;
+		outsideCorner |= depth > clippingPlanes[1] ? 32 : 0;
+
+		outsideAll &= outsideCorner;
+		if( !outsideAll )
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// FrustumCull
+//////////////////////////////////////////////////////////////////////////
+
+IE_CORE_DEFINERUNTIMETYPED( FrustumCull );
+
+size_t FrustumCull::g_firstPlugIndex = 0;
+
+FrustumCull::FrustumCull( const std::string &name )
+	:	CameraVisibilityProcessor( name )
+{
+	storeIndexOfNextChild( g_firstPlugIndex );
+	addChild( new FloatPlug( "padding", Plug::In, 0.1f, 0.0f ) );
+	addChild( new PathMatcherDataPlug( "__excludedPaths", Plug::Out, new PathMatcherData ) );
+}
+
+FrustumCull::~FrustumCull()
+{
+}
+
+Gaffer::FloatPlug *FrustumCull::paddingPlug()
+{
+	return getChild<FloatPlug>( g_firstPlugIndex );
+}
+
+const Gaffer::FloatPlug *FrustumCull::paddingPlug() const
+{
+	return getChild<FloatPlug>( g_firstPlugIndex );
+}
+
+Gaffer::PathMatcherDataPlug *FrustumCull::excludedPathsPlug()
+{
+	return getChild<PathMatcherDataPlug>( g_firstPlugIndex + 1 );
+}
+
+const Gaffer::PathMatcherDataPlug *FrustumCull::excludedPathsPlug() const
+{
+	return getChild<PathMatcherDataPlug>( g_firstPlugIndex + 1 );
+}
+
+void FrustumCull::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const
+{
+	CameraVisibilityProcessor::affects( input, outputs );
+
+	if( input == inPlug()->setPlug() )
+	{
+		outputs.push_back( excludedPathsPlug() );
+	}
+
+	if(
+		input == paddingPlug() ||
+		input == excludedPathsPlug()
+	)
+	{
+		outputs.push_back( outPlug()->attributesPlug() );
+	}
+}
+
+void FrustumCull::hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
+{
+	CameraVisibilityProcessor::hash( output, context, h );
+
+	if( output == excludedPathsPlug() )
+	{
+		h.append( inPlug()->setHash( g_lightsSetName ) );
+		h.append( inPlug()->setHash( g_camerasSetName ) );
+	}
+}
+
+void FrustumCull::compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const
+{
+	if( output == excludedPathsPlug() )
+	{
+		PathMatcherDataPtr result = new PathMatcherData;
+		result->writable().addPaths( inPlug()->set( g_lightsSetName )->readable() );
+		result->writable().addPaths( inPlug()->set( g_camerasSetName )->readable() );
+		static_cast<PathMatcherDataPlug *>( output )->setValue( result );
+		return;
+	}
+
+	CameraVisibilityProcessor::compute( output, context );
+}
+
+bool FrustumCull::culled( const ScenePath &path ) const
+{
+	const Context *context = Context::current();
+	{
+		FilterPlug::SceneScope sceneScope( context, inPlug() );
+		sceneScope.set( ScenePlug::scenePathContextName, path );
+		if( !( filterPlug()->getValue() & IECore::PathMatcher::ExactMatch ) )
+		{
+			return false;
+		}
+	}
+
+	ConstCompoundObjectPtr samples = cameraSamples();
+	const vector<ObjectPtr> &cameras = samples->member<ObjectVector>( camerasName )->members();
+	if( cameras.empty() )
+	{
+		return false;
+	}
+
+	ConstPathMatcherDataPtr excludedPaths;
+	float padding;
+	{
+		ScenePlug::GlobalScope globalScope( context );
+		excludedPaths = excludedPathsPlug()->getValue();
+		padding = paddingPlug()->getValue();
+	}
+
+	// Never hide lights or cameras, which affect the render
+	// even when off screen.
+	if( excludedPaths->readable().match( path ) & ( IECore::PathMatcher::ExactMatch | IECore::PathMatcher::DescendantMatch ) )
+	{
+		return false;
+	}
+
+	// Test against the frustum at each camera sample, so
+	// that locations which move into view during the shutter
+	// are kept. The padding accounts for any motion in between.
+
+	const vector<M44f> &worldToCamera = samples->member<M44fVectorData>( worldToCameraName )->readable();
+	const vector<float> &times = samples->member<FloatVectorData>( timesName )->readable();
+
+	Context::EditableScope timeScope( context );
+	for( size_t i = 0; i < cameras.size(); ++i )
+	{
+		timeScope.setFrame( times[i] );
+		const M44f objectToCamera = inPlug()->fullTransform( path ) * worldToCamera[i];
+		if( !outside( inPlug()->bound( path ), objectToCamera, static_cast<const Camera *>( cameras[i].get() ), padding ) )
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool FrustumCull::hidden( const ScenePath &path ) const
+{
+	return culled( path );
+}
@@ -0,0 +1,287 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2026, Image Engine Design Inc. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "GafferScene/Private/IECoreScenePreview/Renderer.h"
+
+#include "IECore/SimpleTypedData.h"
+#include "IECore/VectorTypedData.h"
+
+#include "tbb/spin_mutex.h"
+
+#include <map>
+
+using namespace std;
+using namespace Imath;
+using namespace IECore;
+using namespace IECoreScenePreview;
+
+//////////////////////////////////////////////////////////////////////////
+// CapturingRenderer
+//
+// A renderer which renders nothing, but records the objects it is given,
+// along with their transforms and attributes. This allows tests to verify
+// exactly what is sent to a renderer, without depending on a particular
+// renderer being available. Captured objects are retrieved using the
+// "capturing:objects" command, and discarded using the "capturing:clear"
+// command. Each captured object is given an "objectId", which is shared
+// by all objects created from the same IECore::Object, allowing tests to
+// verify that objects are shared between locations.
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+class CapturedAttributes : public Renderer::AttributesInterface
+{
+
+	public :
+
+		CapturedAttributes( const CompoundObject *attributes )
+			:	m_attributes( attributes->copy() )
+		{
+		}
+
+		const CompoundObject *attributes() const
+		{
+			return m_attributes.get();
+		}
+
+	private :
+
+		ConstCompoundObjectPtr m_attributes;
+
+};
+
+IE_CORE_DECLAREPTR( CapturedAttributes )
+
+class CapturedObject : public Renderer::ObjectInterface
+{
+
+	public :
+
+		CapturedObject( int objectId, const std::vector<const Object *> &samples, const std::vector<float> &times, const CapturedAttributes *attributes )
+			:	m_objectId( objectId ), m_numSamples( samples.size() ), m_sampleTimes( times ), m_attributes( attributes ),
+				m_transformSamples( { M44f() } ), m_numTransformEdits( 0 ), m_numAttributeEdits( 0 )
+		{
+		}
+
+		void transform( const Imath::M44f &transform ) override
+		{
+			m_transformSamples = { transform };
+			m_transformTimes.clear();
+			m_numTransformEdits++;
+		}
+
+		void transform( const std::vector<Imath::M44f> &samples, const std::vector<float> &times ) override
+		{
+			m_transformSamples = samples;
+			m_transformTimes = times;
+			m_numTransformEdits++;
+		}
+
+		bool attributes( const Renderer::AttributesInterface *attributes ) override
+		{
+			m_attributes = static_cast<const CapturedAttributes *>( attributes );
+			m_numAttributeEdits++;
+			return true;
+		}
+
+		// Returns a description suitable for returning from `command()`.
+		// Only attributes which are Data are included.
+		CompoundDataPtr description() const
+		{
+			CompoundDataPtr result = new CompoundData;
+			CompoundDataMap &members = result->writable();
+
+			members["objectId"] = new IntData( m_objectId );
+			members["numSamples"] = new IntData( m_numSamples );
+			members["sampleTimes"] = new FloatVectorData( m_sampleTimes );
+			members["transform"] = new M44fData( m_transformSamples.front() );
+			members["transformSamples"] = new M44fVectorData( m_transformSamples );
+			members["transformTimes"] = new FloatVectorData( m_transformTimes );
+			members["numTransformEdits"] = new IntData( m_numTransformEdits );
+			members["numAttributeEdits"] = new IntData( m_numAttributeEdits );
+
+			CompoundDataPtr attributes = new CompoundData;
+			for( const auto &a : m_attributes->attributes()->members() )
+			{
+				if( const Data *d = runTimeCast<const Data>( a.second.get() ) )
+				{
+					attributes->writable()[a.first] = d->copy();
+				}
+			}
+			members["attributes"] = attributes;
+
+			return result;
+		}
+
+	private :
+
+		const int m_objectId;
+		const size_t m_numSamples;
+		const std::vector<float> m_sampleTimes;
+		ConstCapturedAttributesPtr m_attributes;
+		std::vector<M44f> m_transformSamples;
+		std::vector<float> m_transformTimes;
+		int m_numTransformEdits;
+		int m_numAttributeEdits;
+
+};
+
+IE_CORE_DECLAREPTR( CapturedObject )
+
+class CapturingRenderer : public Renderer
+{
+
+	public :
+
+		CapturingRenderer( RenderType renderType, const std::string &fileName )
+			:	m_numAttributesCalls( 0 )
+		{
+		}
+
+		IECore::InternedString name() const override
+		{
+			return "Capturing";
+		}
+
+		void option( const IECore::InternedString &name, const IECore::Object *value ) override
+		{
+		}
+
+		void output( const IECore::InternedString &name, const IECoreScene::Output *output ) override
+		{
+		}
+
+		Renderer::AttributesInterfacePtr attributes( const IECore::CompoundObject *attributes ) override
+		{
+			tbb::spin_mutex::scoped_lock lock( m_mutex );
+			m_numAttributesCalls++;
+			return new CapturedAttributes( attributes );
+		}
+
+		ObjectInterfacePtr camera( const std::string &name, const IECoreScene::Camera *camera, const AttributesInterface *attributes ) override
+		{
+			return object( name, camera, attributes );
+		}
+
+		ObjectInterfacePtr light( const std::string &name, const IECore::Object *object, const AttributesInterface *attributes ) override
+		{
+			return this->object( name, object, attributes );
+		}
+
+		Renderer::ObjectInterfacePtr object( const std::string &name, const IECore::Object *object, const AttributesInterface *attributes ) override
+		{
+			return this->object( name, { object }, {}, attributes );
+		}
+
+		ObjectInterfacePtr object( const std::string &name, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, const AttributesInterface *attributes ) override
+		{
+			tbb::spin_mutex::scoped_lock lock( m_mutex );
+
+			// We hold a reference to the object so that its address
+			// can't be reused by a different object while we are
+			// capturing.
+			auto inserted = m_objectIds.insert( ObjectIds::value_type( samples.front(), m_objectIds.size() ) );
+			if( inserted.second )
+			{
+				m_heldObjects.push_back( samples.front() );
+			}
+
+			CapturedObjectPtr result = new CapturedObject( inserted.first->second, samples, times, static_cast<const CapturedAttributes *>( attributes ) );
+			m_objects[name] = result;
+			m_numObjectCalls[name]++;
+			return result;
+		}
+
+		void render() override
+		{
+		}
+
+		void pause() override
+		{
+		}
+
+		IECore::DataPtr command( const IECore::InternedString name, const IECore::CompoundDataMap &parameters ) override
+		{
+			tbb::spin_mutex::scoped_lock lock( m_mutex );
+			if( name == "capturing:objects" )
+			{
+				// Maps from object name to a description of the most
+				// recent object created with that name.
+				CompoundDataPtr result = new CompoundData;
+				for( const auto &o : m_objects )
+				{
+					CompoundDataPtr description = o.second->description();
+					description->writable()["numObjectCalls"] = new IntData( m_numObjectCalls[o.first] );
+					result->writable()[o.first] = description;
+				}
+				return result;
+			}
+			else if( name == "capturing:numAttributesCalls" )
+			{
+				return new IntData( m_numAttributesCalls );
+			}
+			else if( name == "capturing:clear" )
+			{
+				m_objects.clear();
+				m_numObjectCalls.clear();
+				m_objectIds.clear();
+				m_heldObjects.clear();
+				m_numAttributesCalls = 0;
+				return nullptr;
+			}
+
+			return Renderer::command( name, parameters );
+		}
+
+	private :
+
+		tbb::spin_mutex m_mutex;
+		std::map<std::string, CapturedObjectPtr> m_objects;
+		std::map<std::string, int> m_numObjectCalls;
+		typedef std::map<const Object *, int> ObjectIds;
+		ObjectIds m_objectIds;
+		std::vector<ConstObjectPtr> m_heldObjects;
+		int m_numAttributesCalls;
+
+		static Renderer::TypeDescription<CapturingRenderer> g_typeDescription;
+
+};
+
+IECoreScenePreview::Renderer::TypeDescription<CapturingRenderer> CapturingRenderer::g_typeDescription( "Capturing" );
+
+} // namespace
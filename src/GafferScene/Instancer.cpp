@@ -37,6 +37,11 @@
 
 #include "GafferScene/Instancer.h"
 
+#include "GafferScene/Capsule.h"
+#include "GafferScene/Private/IECoreScenePreview/Renderer.h"
+#include "GafferScene/RendererAlgo.h"
+#include "GafferScene/SceneAlgo.h"
+
 #include "Gaffer/Context.h"
 #include "Gaffer/StringPlug.h"
 
@@ -47,11 +52,14 @@
 #include "IECore/NullObject.h"
 #include "IECore/VectorTypedData.h"
 
+#include "boost/bind.hpp"
 #include "boost/lexical_cast.hpp"
 
 #include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
 #include "tbb/parallel_reduce.h"
 
+#include <algorithm>
 #include <functional>
 #include <unordered_map>
 
@@ -334,6 +342,343 @@ class Instancer::EngineData : public Data
 
 };
 
+//////////////////////////////////////////////////////////////////////////
+// InstancerCapsule
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+const InternedString g_visibleAttributeName( "scene:visible" );
+const InternedString g_setsAttributeName( "sets" );
+const InternedString g_deformationBlurOptionName( "option:render:deformationBlur" );
+const InternedString g_deformationBlurAttributeName( "gaffer:deformationBlur" );
+const InternedString g_deformationBlurSegmentsAttributeName( "gaffer:deformationBlurSegments" );
+
+// A location within a prototype, evaluated ready for output
+// to the renderer.
+struct PrototypeLocation
+{
+	// Relative to the instance location.
+	std::string name;
+	// Relative to the instance location, sampled only at the
+	// current frame. Transform blur for locations within an
+	// encapsulated prototype is therefore lost.
+	M44f transform;
+	// Full attributes, as inherited from the globals down.
+	ConstCompoundObjectPtr attributes;
+	// Attributes from the locations beneath the prototype root. Per-instance
+	// attributes are inserted between the root and these.
+	ConstCompoundObjectPtr descendantAttributes;
+	vector<ConstVisibleRenderablePtr> samples;
+	vector<float> sampleTimes;
+};
+
+ConstCompoundObjectPtr mergeAttributes( const CompoundObject *parentAttributes, const CompoundObject *attributes, const InternedStringVectorData *sets )
+{
+	if( attributes->members().empty() && !sets )
+	{
+		return parentAttributes;
+	}
+
+	CompoundObjectPtr result = new CompoundObject;
+	result->members() = parentAttributes->members();
+	for( const auto &a : attributes->members() )
+	{
+		result->members()[a.first] = a.second;
+	}
+	if( sets )
+	{
+		result->members()[g_setsAttributeName] = const_cast<InternedStringVectorData *>( sets );
+	}
+	return result;
+}
+
+// Evaluates all the renderable locations in a prototype, in the
+// same way that `RendererAlgo::outputObjects()` would.
+class PrototypeGatherer
+{
+
+	public :
+
+		PrototypeGatherer( const ScenePlug *prototypes, const CompoundObject *globals, const V2f &shutter, vector<PrototypeLocation> &locations )
+			:	m_prototypes( prototypes ), m_renderSets( prototypes ), m_globalAttributes( SceneAlgo::globalAttributes( globals ) ),
+				m_shutter( shutter ), m_locations( locations )
+		{
+			const BoolData *deformationBlurData = globals->member<BoolData>( g_deformationBlurOptionName );
+			m_deformationBlur = deformationBlurData ? deformationBlurData->readable() : false;
+		}
+
+		void gather( const ScenePlug::ScenePath &prototypeRoot )
+		{
+			ScenePlug::ScenePath path = prototypeRoot;
+			CompoundObjectPtr noAttributes = new CompoundObject;
+			gather( path, "", M44f(), m_globalAttributes.get(), noAttributes.get() );
+		}
+
+	private :
+
+		void gather( ScenePlug::ScenePath &path, const std::string &name, const M44f &parentTransform, const CompoundObject *parentAttributes, const CompoundObject *parentDescendantAttributes )
+		{
+			ScenePlug::PathScope pathScope( Context::current(), path );
+
+			ConstCompoundObjectPtr locationAttributes = m_prototypes->attributesPlug()->getValue();
+			ConstInternedStringVectorDataPtr sets = m_renderSets.setsAttribute( path );
+			ConstCompoundObjectPtr attributes = mergeAttributes( parentAttributes, locationAttributes.get(), sets.get() );
+			// The attributes at the prototype root are combined with the
+			// per-instance attributes, so aren't included here.
+			ConstCompoundObjectPtr descendantAttributes = name.empty() ?
+				ConstCompoundObjectPtr( parentDescendantAttributes ) :
+				mergeAttributes( parentDescendantAttributes, locationAttributes.get(), sets.get() )
+			;
+
+			if( const BoolData *visible = attributes->member<BoolData>( g_visibleAttributeName ) )
+			{
+				if( !visible->readable() )
+				{
+					return;
+				}
+			}
+
+			const M44f transform = m_prototypes->transformPlug()->getValue() * parentTransform;
+
+			if(
+				!( m_renderSets.camerasSet().match( path ) & PathMatcher::ExactMatch ) &&
+				!( m_renderSets.lightsSet().match( path ) & PathMatcher::ExactMatch )
+			)
+			{
+				PrototypeLocation location;
+				set<float> sampleTimes;
+				RendererAlgo::objectSamples( m_prototypes, deformationSegments( attributes.get() ), m_shutter, location.samples, sampleTimes );
+				if( location.samples.size() )
+				{
+					location.name = name;
+					location.transform = transform;
+					location.attributes = attributes;
+					location.descendantAttributes = descendantAttributes;
+					location.sampleTimes.insert( location.sampleTimes.end(), sampleTimes.begin(), sampleTimes.end() );
+					m_locations.push_back( location );
+				}
+			}
+
+			ConstInternedStringVectorDataPtr childNames = m_prototypes->childNamesPlug()->getValue();
+			for( const auto &childName : childNames->readable() )
+			{
+				path.push_back( childName );
+				gather( path, name + "/" + childName.string(), transform, attributes.get(), descendantAttributes.get() );
+				path.pop_back();
+			}
+		}
+
+		size_t deformationSegments( const CompoundObject *attributes ) const
+		{
+			if( !m_deformationBlur )
+			{
+				return 0;
+			}
+
+			if( const BoolData *d = attributes->member<BoolData>( g_deformationBlurAttributeName ) )
+			{
+				if( !d->readable() )
+				{
+					return 0;
+				}
+			}
+
+			const IntData *d = attributes->member<IntData>( g_deformationBlurSegmentsAttributeName );
+			return d ? d->readable() : 1;
+		}
+
+		const ScenePlug *m_prototypes;
+		const RendererAlgo::RenderSets m_renderSets;
+		ConstCompoundObjectPtr m_globalAttributes;
+		bool m_deformationBlur;
+		V2f m_shutter;
+		vector<PrototypeLocation> &m_locations;
+
+};
+
+} // namespace
+
+// Capsule for a single `/instances/<instanceName>` location. Rather than
+// expanding the scene hierarchy for every point, we evaluate the prototype
+// once and output it to the renderer for each point in turn. Because every
+// instance shares the same objects, renderers are free to instance them.
+class Instancer::InstancerCapsule : public Capsule
+{
+
+	public :
+
+		InstancerCapsule()
+			:	m_prototypeIndex( 0 ), m_numPrototypes( 0 )
+		{
+		}
+
+		InstancerCapsule(
+			const ScenePlug *scene,
+			const ScenePlug::ScenePath &root,
+			const Gaffer::Context &context,
+			const IECore::MurmurHash &hash,
+			const Imath::Box3f &bound,
+			ConstEngineDataPtr engine,
+			size_t prototypeIndex,
+			size_t numPrototypes
+		)
+			:	Capsule( scene, root, context, hash, bound ), m_engine( engine ), m_prototypeIndex( prototypeIndex ), m_numPrototypes( numPrototypes )
+		{
+		}
+
+		IE_CORE_DECLAREEXTENSIONOBJECT( GafferScene::Instancer::InstancerCapsule, GafferScene::InstancerCapsuleTypeId, GafferScene::Capsule );
+
+		void render( IECoreScenePreview::Renderer *renderer ) const override
+		{
+			// Note that `scene()` throws if the capsule has expired.
+			const Instancer *instancer = static_cast<const Instancer *>( scene()->node() );
+			// Paths are set explicitly for each prototype location, and the
+			// globals and sets must be evaluated without one.
+			ScenePlug::GlobalScope globalScope( context() );
+
+			ConstCompoundObjectPtr globals = scene()->globalsPlug()->getValue();
+
+			vector<PrototypeLocation> locations;
+			PrototypeGatherer gatherer( instancer->instancesPlug(), globals.get(), SceneAlgo::shutter( globals.get(), scene() ), locations );
+			gatherer.gather( { root().back() } );
+			if( locations.empty() || !m_numPrototypes )
+			{
+				return;
+			}
+
+			// Without per-instance attributes, we can share a single
+			// attributes block between every instance of a location.
+			const bool instanceAttributes = m_engine->numInstanceAttributes();
+			vector<IECoreScenePreview::Renderer::AttributesInterfacePtr> sharedAttributes;
+			if( !instanceAttributes )
+			{
+				for( const auto &location : locations )
+				{
+					sharedAttributes.push_back( renderer->attributes( location.attributes.get() ) );
+				}
+			}
+
+			const EngineData *engine = m_engine.get();
+			task_group_context taskGroupContext( task_group_context::isolated );
+			parallel_for(
+				blocked_range<size_t>( 0, engine->numPoints() ),
+				[&] ( const blocked_range<size_t> &range ) {
+					vector<const Object *> samples;
+					for( size_t i = range.begin(); i != range.end(); ++i )
+					{
+						if( engine->instanceIndex( i ) % m_numPrototypes != m_prototypeIndex )
+						{
+							continue;
+						}
+
+						const M44f pointTransform = engine->instanceTransform( i );
+						// Ids are stored as ints, so the cast recovers negative ids, naming
+						// them as the child locations are named.
+						const std::string instanceName = "/" + std::to_string( static_cast<int64_t>( engine->instanceId( i ) ) );
+						CompoundObjectPtr pointAttributes = instanceAttributes ? engine->instanceAttributes( i ) : nullptr;
+
+						for( size_t l = 0; l < locations.size(); ++l )
+						{
+							const PrototypeLocation &location = locations[l];
+
+							IECoreScenePreview::Renderer::AttributesInterfacePtr attributes;
+							if( pointAttributes )
+							{
+								// Per-instance attributes take precedence over the attributes
+								// at the prototype root, but not over those of its descendants.
+								CompoundObjectPtr a = new CompoundObject;
+								a->members() = location.attributes->members();
+								for( const auto &p : pointAttributes->members() )
+								{
+									a->members()[p.first] = p.second;
+								}
+								for( const auto &d : location.descendantAttributes->members() )
+								{
+									a->members()[d.first] = d.second;
+								}
+								attributes = renderer->attributes( a.get() );
+							}
+							else
+							{
+								attributes = sharedAttributes[l];
+							}
+
+							IECoreScenePreview::Renderer::ObjectInterfacePtr objectInterface;
+							if( location.sampleTimes.empty() )
+							{
+								objectInterface = renderer->object( instanceName + location.name, location.samples[0].get(), attributes.get() );
+							}
+							else
+							{
+								samples.clear();
+								for( const auto &s : location.samples )
+								{
+									samples.push_back( s.get() );
+								}
+								objectInterface = renderer->object( instanceName + location.name, samples, location.sampleTimes, attributes.get() );
+							}
+
+							if( objectInterface )
+							{
+								objectInterface->transform( location.transform * pointTransform );
+							}
+						}
+					}
+				},
+				taskGroupContext
+			);
+		}
+
+	private :
+
+		ConstEngineDataPtr m_engine;
+		size_t m_prototypeIndex;
+		size_t m_numPrototypes;
+
+};
+
+IE_CORE_DEFINEOBJECTTYPEDESCRIPTION( Instancer::InstancerCapsule );
+
+bool Instancer::InstancerCapsule::isEqualTo( const IECore::Object *other ) const
+{
+	// The hash provided on construction accounts for
+	// everything, so there's nothing more to compare.
+	return Capsule::isEqualTo( other );
+}
+
+void Instancer::InstancerCapsule::hash( IECore::MurmurHash &h ) const
+{
+	Capsule::hash( h );
+}
+
+void Instancer::InstancerCapsule::copyFrom( const IECore::Object *other, IECore::Object::CopyContext *context )
+{
+	Capsule::copyFrom( other, context );
+
+	const InstancerCapsule *capsule = static_cast<const InstancerCapsule *>( other );
+	m_engine = capsule->m_engine;
+	m_prototypeIndex = capsule->m_prototypeIndex;
+	m_numPrototypes = capsule->m_numPrototypes;
+}
+
+void Instancer::InstancerCapsule::save( IECore::Object::SaveContext *context ) const
+{
+	Capsule::save( context );
+}
+
+void Instancer::InstancerCapsule::load( IECore::Object::LoadContextPtr context )
+{
+	Capsule::load( context );
+}
+
+void Instancer::InstancerCapsule::memoryUsage( IECore::Object::MemoryAccumulator &accumulator ) const
+{
+	Capsule::memoryUsage( accumulator );
+	accumulator.accumulate( sizeof( InstancerCapsule ) - sizeof( Capsule ) );
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Instancer
 //////////////////////////////////////////////////////////////////////////
@@ -345,7 +690,7 @@ size_t Instancer::g_firstPlugIndex = 0;
 static const IECore::InternedString idContextName( "instancer:id" );
 
 Instancer::Instancer( const std::string &name )
-	:	BranchCreator( name )
+	:	BranchCreator( name ), m_instancesDirtyCount( 0 )
 {
 	storeIndexOfNextChild( g_firstPlugIndex );
 	addChild( new StringPlug( "name", Plug::In, "instances" ) );
@@ -356,8 +701,11 @@ Instancer::Instancer( const std::string &name )
 	addChild( new StringPlug( "orientation", Plug::In ) );
 	addChild( new StringPlug( "scale", Plug::In ) );
 	addChild( new StringPlug( "attributes", Plug::In ) );
+	addChild( new BoolPlug( "encapsulateInstanceGroups", Plug::In, false ) );
 	addChild( new ObjectPlug( "__engine", Plug::Out, NullObject::defaultNullObject() ) );
 	addChild( new AtomicCompoundDataPlug( "__instanceChildNames", Plug::Out, new CompoundData ) );
+
+	plugDirtiedSignal().connect( boost::bind( &Instancer::plugDirtied, this, ::_1 ) );
 }
 
 Instancer::~Instancer()
@@ -444,24 +792,34 @@ const Gaffer::StringPlug *Instancer::attributesPlug() const
 	return getChild<StringPlug>( g_firstPlugIndex + 7 );
 }
 
+Gaffer::BoolPlug *Instancer::encapsulateInstanceGroupsPlug()
+{
+	return getChild<BoolPlug>( g_firstPlugIndex + 8 );
+}
+
+const Gaffer::BoolPlug *Instancer::encapsulateInstanceGroupsPlug() const
+{
+	return getChild<BoolPlug>( g_firstPlugIndex + 8 );
+}
+
 Gaffer::ObjectPlug *Instancer::enginePlug()
 {
-	return getChild<ObjectPlug>( g_firstPlugIndex + 8 );
+	return getChild<ObjectPlug>( g_firstPlugIndex + 9 );
 }
 
 const Gaffer::ObjectPlug *Instancer::enginePlug() const
 {
-	return getChild<ObjectPlug>( g_firstPlugIndex + 8 );
+	return getChild<ObjectPlug>( g_firstPlugIndex + 9 );
 }
 
 Gaffer::AtomicCompoundDataPlug *Instancer::instanceChildNamesPlug()
 {
-	return getChild<AtomicCompoundDataPlug>( g_firstPlugIndex + 9 );
+	return getChild<AtomicCompoundDataPlug>( g_firstPlugIndex + 10 );
 }
 
 const Gaffer::AtomicCompoundDataPlug *Instancer::instanceChildNamesPlug() const
 {
-	return getChild<AtomicCompoundDataPlug>( g_firstPlugIndex + 9 );
+	return getChild<AtomicCompoundDataPlug>( g_firstPlugIndex + 10 );
 }
 
 void Instancer::affects( const Plug *input, AffectedPlugsContainer &outputs ) const
@@ -492,7 +850,8 @@ void Instancer::affects( const Plug *input, AffectedPlugsContainer &outputs ) co
 	if(
 		input == namePlug() ||
 		input == instanceChildNamesPlug() ||
-		input == instancesPlug()->childNamesPlug()
+		input == instancesPlug()->childNamesPlug() ||
+		input == encapsulateInstanceGroupsPlug()
 	)
 	{
 		outputs.push_back( outPlug()->childNamesPlug() );
@@ -503,7 +862,8 @@ void Instancer::affects( const Plug *input, AffectedPlugsContainer &outputs ) co
 		input == namePlug() ||
 		input == instancesPlug()->boundPlug() ||
 		input == instancesPlug()->transformPlug() ||
-		input == instanceChildNamesPlug()
+		input == instanceChildNamesPlug() ||
+		input == encapsulateInstanceGroupsPlug()
 	)
 	{
 		outputs.push_back( outPlug()->boundPlug() );
@@ -517,11 +877,21 @@ void Instancer::affects( const Plug *input, AffectedPlugsContainer &outputs ) co
 		outputs.push_back( outPlug()->transformPlug() );
 	}
 
-	if( input == instancesPlug()->objectPlug() )
+	if(
+		input->parent() == instancesPlug() ||
+		input == enginePlug() ||
+		input == encapsulateInstanceGroupsPlug()
+	)
 	{
+		// Capsules depend on the entire instances scene.
 		outputs.push_back( outPlug()->objectPlug() );
 	}
 
+	if( input == encapsulateInstanceGroupsPlug() )
+	{
+		outputs.push_back( outPlug()->setPlug() );
+	}
+
 	if(
 		input == instancesPlug()->attributesPlug() ||
 		input == enginePlug()
@@ -628,6 +998,7 @@ void Instancer::hashBranchBound( const ScenePath &parentPath, const ScenePath &b
 
 		engineHash( parentPath, context, h );
 		instanceChildNamesHash( parentPath, context, h );
+		encapsulateInstanceGroupsPlug()->hash( h );
 		h.append( branchPath.back() );
 
 		{
@@ -666,8 +1037,6 @@ Imath::Box3f Instancer::computeBranchBound( const ScenePath &parentPath, const S
 		// more efficiently than `unionOfTransformedChildBounds()`.
 
 		ConstEngineDataPtr e = engine( parentPath, context );
-		ConstCompoundDataPtr ic = instanceChildNames( parentPath, context );
-		const vector<InternedString> &childNames = ic->member<InternedStringVectorData>( branchPath.back() )->readable();
 
 		M44f childTransform;
 		Box3f childBound;
@@ -677,10 +1046,51 @@ Imath::Box3f Instancer::computeBranchBound( const ScenePath &parentPath, const S
 			childBound = instancesPlug()->boundPlug()->getValue();
 		}
 
+		task_group_context taskGroupContext( task_group_context::isolated );
+
+		if( encapsulateInstanceGroupsPlug()->getValue() )
+		{
+			// There are no child locations, so we visit the points directly
+			// rather than paying for `instanceChildNames()`.
+			ConstInternedStringVectorDataPtr instanceNames = instancesPlug()->childNames( ScenePath() );
+			const vector<InternedString> &names = instanceNames->readable();
+			const size_t prototypeIndex = std::find( names.begin(), names.end(), branchPath.back() ) - names.begin();
+			const size_t numPrototypes = names.size();
+
+			typedef blocked_range<size_t> PointRange;
+			return parallel_reduce(
+				PointRange( 0, e->numPoints() ),
+				Box3f(),
+				[ &e, &childBound, &childTransform, prototypeIndex, numPrototypes ] ( const PointRange &r, Box3f u ) {
+					for( size_t i = r.begin(); i != r.end(); ++i )
+					{
+						if( e->instanceIndex( i ) % numPrototypes != prototypeIndex )
+						{
+							continue;
+						}
+						const M44f m = childTransform * e->instanceTransform( i );
+						u.extendBy( transform( childBound, m ) );
+					}
+					return u;
+				},
+				// Union
+				[] ( const Box3f &b0, const Box3f &b1 ) {
+					Box3f u( b0 );
+					u.extendBy( b1 );
+					return u;
+				},
+				tbb::auto_partitioner(),
+				// Prevents outer tasks silently cancelling our tasks
+				taskGroupContext
+			);
+		}
+
+		ConstCompoundDataPtr ic = instanceChildNames( parentPath, context );
+		const vector<InternedString> &childNames = ic->member<InternedStringVectorData>( branchPath.back() )->readable();
+
 		typedef vector<InternedString>::const_iterator Iterator;
 		typedef blocked_range<Iterator> Range;
 
-		task_group_context taskGroupContext( task_group_context::isolated );
 		return parallel_reduce(
 			Range( childNames.begin(), childNames.end() ),
 			Box3f(),
@@ -840,7 +1250,22 @@ IECore::ConstCompoundObjectPtr Instancer::computeBranchAttributes( const ScenePa
 
 void Instancer::hashBranchObject( const ScenePath &parentPath, const ScenePath &branchPath, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
-	if( branchPath.size() <= 2 )
+	if( branchPath.size() == 2 && encapsulateInstanceGroupsPlug()->getValue() )
+	{
+		// "/instances/<instanceName>"
+		BranchCreator::hashBranchObject( parentPath, branchPath, context, h );
+		// As for the Encapsulate node, we'd ideally hash the entire
+		// prototype hierarchy, but that could be prohibitively expensive.
+		// Instead we use a "poor man's hash" based on our identity, the
+		// number of times the instances have been dirtied and the entire
+		// context.
+		h.append( reinterpret_cast<uint64_t>( this ) );
+		h.append( m_instancesDirtyCount );
+		h.append( context->hash() );
+		engineHash( parentPath, context, h );
+		h.append( instancesPlug()->childNamesHash( ScenePath() ) );
+	}
+	else if( branchPath.size() <= 2 )
 	{
 		// "/" or "/instances" or "/instances/<instanceName>"
 		h = outPlug()->objectPlug()->defaultValue()->Object::hash();
@@ -855,7 +1280,25 @@ void Instancer::hashBranchObject( const ScenePath &parentPath, const ScenePath &
 
 IECore::ConstObjectPtr Instancer::computeBranchObject( const ScenePath &parentPath, const ScenePath &branchPath, const Gaffer::Context *context ) const
 {
-	if( branchPath.size() <= 2 )
+	if( branchPath.size() == 2 && encapsulateInstanceGroupsPlug()->getValue() )
+	{
+		// "/instances/<instanceName>"
+		ConstInternedStringVectorDataPtr instanceNames = instancesPlug()->childNames( ScenePath() );
+		const vector<InternedString> &names = instanceNames->readable();
+		const size_t prototypeIndex = std::find( names.begin(), names.end(), branchPath.back() ) - names.begin();
+
+		return new InstancerCapsule(
+			outPlug(),
+			context->get<ScenePath>( ScenePlug::scenePathContextName ),
+			*context,
+			outPlug()->objectPlug()->hash(),
+			outPlug()->boundPlug()->getValue(),
+			engine( parentPath, context ),
+			prototypeIndex,
+			names.size()
+		);
+	}
+	else if( branchPath.size() <= 2 )
 	{
 		// "/" or "/instances" or "/instances/<instanceName>"
 		return outPlug()->objectPlug()->defaultValue();
@@ -884,6 +1327,11 @@ void Instancer::hashBranchChildNames( const ScenePath &parentPath, const ScenePa
 	else if( branchPath.size() == 2 )
 	{
 		// "/instances/<instanceName>"
+		if( encapsulateInstanceGroupsPlug()->getValue() )
+		{
+			h = outPlug()->childNamesPlug()->defaultValue()->Object::hash();
+			return;
+		}
 		BranchCreator::hashBranchChildNames( parentPath, branchPath, context, h );
 		instanceChildNamesHash( parentPath, context, h );
 		h.append( branchPath.back() );
@@ -918,6 +1366,10 @@ IECore::ConstInternedStringVectorDataPtr Instancer::computeBranchChildNames( con
 	else if( branchPath.size() == 2 )
 	{
 		// "/instances/<instanceName>"
+		if( encapsulateInstanceGroupsPlug()->getValue() )
+		{
+			return outPlug()->childNamesPlug()->defaultValue();
+		}
 		IECore::ConstCompoundDataPtr ic = instanceChildNames( parentPath, context );
 		return ic->member<InternedStringVectorData>( branchPath.back() );
 	}
@@ -943,6 +1395,13 @@ void Instancer::hashBranchSet( const ScenePath &parentPath, const IECore::Intern
 {
 	BranchCreator::hashBranchSet( parentPath, setName, context, h );
 
+	if( encapsulateInstanceGroupsPlug()->getValue() )
+	{
+		// Sets can't refer to locations inside the capsules,
+		// so are always empty.
+		return;
+	}
+
 	h.append( instancesPlug()->childNamesHash( ScenePath() ) );
 	instanceChildNamesHash( parentPath, context, h );
 	instancesPlug()->setPlug()->hash( h );
@@ -951,6 +1410,11 @@ void Instancer::hashBranchSet( const ScenePath &parentPath, const IECore::Intern
 
 IECore::ConstPathMatcherDataPtr Instancer::computeBranchSet( const ScenePath &parentPath, const IECore::InternedString &setName, const Gaffer::Context *context ) const
 {
+	if( encapsulateInstanceGroupsPlug()->getValue() )
+	{
+		return outPlug()->setPlug()->defaultValue();
+	}
+
 	ConstInternedStringVectorDataPtr instanceNames = instancesPlug()->childNames( ScenePath() );
 	IECore::ConstCompoundDataPtr instanceChildNames = this->instanceChildNames( parentPath, context );
 	ConstPathMatcherDataPtr inputSet = instancesPlug()->setPlug()->getValue();
@@ -1019,3 +1483,11 @@ Instancer::InstanceScope::InstanceScope( const Gaffer::Context *context, const S
 	}
 	set( ScenePlug::scenePathContextName, instancePath );
 }
+
+void Instancer::plugDirtied( const Gaffer::Plug *plug )
+{
+	if( plug->parent() == instancesPlug() )
+	{
+		++m_instancesDirtyCount;
+	}
+}
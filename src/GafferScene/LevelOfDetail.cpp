@@ -0,0 +1,223 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2026, Image Engine Design Inc. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "GafferScene/LevelOfDetail.h"
+
+#include "IECoreScene/Camera.h"
+
+#include "IECore/ObjectVector.h"
+#include "IECore/VectorTypedData.h"
+
+#include "OpenEXR/ImathMatrixAlgo.h"
+
+#include <limits>
+
+using namespace std;
+using namespace Imath;
+using namespace IECore;
+using namespace IECoreScene;
+using namespace Gaffer;
+using namespace GafferScene;
+
+//////////////////////////////////////////////////////////////////////////
+// Internal utilities
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Returns the diameter of the bounding sphere of `bound`, projected onto
+// the screen and measured as a fraction of the screen window's width.
+float screenSize( const Box3f &bound, const M44f &objectToCamera, const Camera *camera )
+{
+	if( bound.isEmpty() )
+	{
+		return 0.0f;
+	}
+
+	V3f scale;
+	if( !extractScaling( objectToCamera, scale, /* exc = */ false ) )
+	{
+		return 0.0f;
+	}
+
+	const V3f center = bound.center() * objectToCamera;
+	const float radius = 0.5f * bound.size().length() * max( fabs( scale.x ), max( fabs( scale.y ), fabs( scale.z ) ) );
+
+	const Box2f screenWindow = camera->hasResolution() ? camera->frustum() : camera->frustum( Camera::Distort );
+	const float screenWidth = screenWindow.size().x;
+	if( screenWidth <= 0.0f )
+	{
+		return 0.0f;
+	}
+
+	if( camera->getProjection() == "perspective" )
+	{
+		// Use the distance to the centre rather than the depth, so that
+		// bounds behind the camera are still sized by how far away they
+		// are, rather than being mistaken for surrounding the camera.
+		const float distance = center.length();
+		if( distance <= radius )
+		{
+			// The camera is inside the bounding sphere.
+			return numeric_limits<float>::max();
+		}
+		return 2.0f * radius / ( distance * screenWidth );
+	}
+	else
+	{
+		return 2.0f * radius / screenWidth;
+	}
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// LevelOfDetail
+//////////////////////////////////////////////////////////////////////////
+
+IE_CORE_DEFINERUNTIMETYPED( LevelOfDetail );
+
+size_t LevelOfDetail::g_firstPlugIndex = 0;
+
+LevelOfDetail::LevelOfDetail( const std::string &name )
+	:	CameraVisibilityProcessor( name )
+{
+	storeIndexOfNextChild( g_firstPlugIndex );
+
+	FloatVectorDataPtr defaultThresholds = new FloatVectorData;
+	defaultThresholds->writable().push_back( 0.25f );
+	defaultThresholds->writable().push_back( 0.05f );
+	addChild( new FloatVectorDataPlug( "thresholds", Plug::In, defaultThresholds ) );
+}
+
+LevelOfDetail::~LevelOfDetail()
+{
+}
+
+Gaffer::FloatVectorDataPlug *LevelOfDetail::thresholdsPlug()
+{
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex );
+}
+
+const Gaffer::FloatVectorDataPlug *LevelOfDetail::thresholdsPlug() const
+{
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex );
+}
+
+void LevelOfDetail::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const
+{
+	CameraVisibilityProcessor::affects( input, outputs );
+
+	if( input == thresholdsPlug() )
+	{
+		outputs.push_back( outPlug()->attributesPlug() );
+	}
+}
+
+size_t LevelOfDetail::representation( const ScenePath &path ) const
+{
+	ConstInternedStringVectorDataPtr childNamesData = inPlug()->childNames( path );
+	const size_t numRepresentations = childNamesData->readable().size();
+
+	if( numRepresentations < 2 )
+	{
+		return 0;
+	}
+
+	ConstFloatVectorDataPtr thresholdsData;
+	{
+		ScenePlug::GlobalScope globalScope( Context::current() );
+		thresholdsData = thresholdsPlug()->getValue();
+	}
+	const vector<float> &thresholds = thresholdsData->readable();
+	if( thresholds.empty() )
+	{
+		return 0;
+	}
+
+	ConstCompoundObjectPtr samples = cameraSamples();
+	const vector<ObjectPtr> &cameras = samples->member<ObjectVector>( camerasName )->members();
+	const vector<M44f> &worldToCamera = samples->member<M44fVectorData>( worldToCameraName )->readable();
+	const vector<float> &times = samples->member<FloatVectorData>( timesName )->readable();
+	if( cameras.empty() )
+	{
+		return 0;
+	}
+
+	// Measure the screen size at each camera sample, using the
+	// largest so that we never choose a lower detail representation
+	// than is needed at any point in the shutter.
+
+	float size = 0.0f;
+	Context::EditableScope timeScope( Context::current() );
+	for( size_t i = 0; i < cameras.size(); ++i )
+	{
+		timeScope.setFrame( times[i] );
+		const M44f objectToCamera = inPlug()->fullTransform( path ) * worldToCamera[i];
+		size = max( size, screenSize( inPlug()->bound( path ), objectToCamera, static_cast<const Camera *>( cameras[i].get() ) ) );
+	}
+
+	size_t result = 0;
+	while( result < thresholds.size() && size < thresholds[result] )
+	{
+		++result;
+	}
+
+	return min( result, numRepresentations - 1 );
+}
+
+bool LevelOfDetail::hidden( const ScenePath &path ) const
+{
+	if( path.empty() )
+	{
+		return false;
+	}
+
+	const ScenePath groupPath( path.begin(), path.end() - 1 );
+	{
+		FilterPlug::SceneScope sceneScope( Context::current(), inPlug() );
+		sceneScope.set( ScenePlug::scenePathContextName, groupPath );
+		if( !( filterPlug()->getValue() & IECore::PathMatcher::ExactMatch ) )
+		{
+			return false;
+		}
+	}
+
+	ConstInternedStringVectorDataPtr childNamesData = inPlug()->childNames( groupPath );
+	const vector<InternedString> &childNames = childNamesData->readable();
+	return childNames[representation( groupPath )] != path.back();
+}
@@ -36,6 +36,8 @@
 
 #include "GafferScene/MapOffset.h"
 
+#include "GafferScene/PrimitiveVariableAlgo.h"
+
 #include "Gaffer/StringPlug.h"
 
 #include "IECoreScene/Primitive.h"
@@ -160,12 +162,15 @@ IECore::ConstObjectPtr MapOffset::computeProcessedObject( const ScenePath &path,
 	offset.x += (udim - 1001) % 10;
 	offset.y += (udim - 1001) / 10;
 
-	if( V2fVectorData *uvData = runTimeCast<V2fVectorData>( result->variables[uvSet].data.get() ) )
+	PrimitiveVariable &uvVariable = result->variables[uvSet];
+	if( const V2fVectorData *uvData = runTimeCast<const V2fVectorData>( uvVariable.data.get() ) )
 	{
-		for( V2f &uv : uvData->writable() )
-		{
-			uv += offset;
-		}
+		uvVariable.data = PrimitiveVariableAlgo::transformElements(
+			uvData,
+			[&offset]( const V2f &uv ) {
+				return uv + offset;
+			}
+		);
 	}
 
 	return result;
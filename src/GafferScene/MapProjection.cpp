@@ -36,6 +36,8 @@
 
 #include "GafferScene/MapProjection.h"
 
+#include "GafferScene/PrimitiveVariableAlgo.h"
+
 #include "Gaffer/StringPlug.h"
 
 #include "IECoreScene/Camera.h"
@@ -188,23 +190,28 @@ IECore::ConstObjectPtr MapProjection::computeProcessedObject( const ScenePath &p
 
 	const vector<V3f> &p = pData->readable();
 	vector<V2f> &uv = uvData->writable();
-	uv.reserve( p.size() );
-
-	for( size_t i = 0, e = p.size(); i < e; ++i )
-	{
-		V3f pCamera = p[i] * objectToCamera;
-		V2f pScreen = V2f( pCamera.x, pCamera.y );
-		if( perspective )
-		{
-			pScreen /= -pCamera.z;
+	uv.resize( p.size() );
+
+	const V3f *pIn = p.data();
+	V2f *uvOut = uv.data();
+	PrimitiveVariableAlgo::parallelProcessElements(
+		p.size(),
+		[&]( size_t begin, size_t end ) {
+			for( size_t i = begin; i < end; ++i )
+			{
+				V3f pCamera = pIn[i] * objectToCamera;
+				V2f pScreen = V2f( pCamera.x, pCamera.y );
+				if( perspective )
+				{
+					pScreen /= -pCamera.z;
+				}
+				uvOut[i] = V2f(
+					lerpfactor( pScreen.x, normalizedScreenWindow.min.x, normalizedScreenWindow.max.x ),
+					lerpfactor( pScreen.y, normalizedScreenWindow.min.y, normalizedScreenWindow.max.y )
+				);
+			}
 		}
-		uv.push_back(
-			V2f(
-				lerpfactor( pScreen.x, normalizedScreenWindow.min.x, normalizedScreenWindow.max.x ),
-				lerpfactor( pScreen.y, normalizedScreenWindow.min.y, normalizedScreenWindow.max.y )
-			)
-		);
-	}
+	);
 
 	return result;
 }
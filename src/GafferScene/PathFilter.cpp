@@ -125,6 +125,17 @@ void PathFilter::affects( const Gaffer::Plug *input, AffectedPlugsContainer &out
 	}
 }
 
+bool PathFilter::knownMatches( IECore::PathMatcher &paths ) const
+{
+	if( !m_pathMatcher )
+	{
+		return false;
+	}
+
+	paths = m_pathMatcher->readable();
+	return true;
+}
+
 void PathFilter::hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	Filter::hash( output, context, h );
@@ -0,0 +1,131 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2026, Image Engine Design Inc. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "GafferScene/PrimitiveVariableAlgo.h"
+
+#include "IECoreScene/Primitive.h"
+
+#include "IECore/VectorTypedData.h"
+
+#include <unordered_map>
+
+using namespace std;
+using namespace Imath;
+using namespace IECore;
+using namespace IECoreScene;
+using namespace GafferScene;
+
+//////////////////////////////////////////////////////////////////////////
+// Internal utilities
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+template<typename T>
+DataPtr transformVectors( const T *data, const M44f &matrix, const M44f &normalMatrix, size_t grainSize )
+{
+	using Vec = typename T::ValueType::value_type;
+	switch( data->getInterpretation() )
+	{
+		case GeometricData::Point :
+			return PrimitiveVariableAlgo::transformElements(
+				data,
+				[&matrix]( const Vec &v ) {
+					return v * matrix;
+				},
+				grainSize
+			);
+		case GeometricData::Vector :
+			return PrimitiveVariableAlgo::transformElements(
+				data,
+				[&matrix]( const Vec &v ) {
+					Vec result;
+					matrix.multDirMatrix( v, result );
+					return result;
+				},
+				grainSize
+			);
+		case GeometricData::Normal :
+			return PrimitiveVariableAlgo::transformElements(
+				data,
+				[&normalMatrix]( const Vec &v ) {
+					Vec result;
+					normalMatrix.multDirMatrix( v, result );
+					return result;
+				},
+				grainSize
+			);
+		default :
+			return nullptr;
+	}
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// Public functions
+//////////////////////////////////////////////////////////////////////////
+
+void PrimitiveVariableAlgo::transformPrimitiveVariables( IECoreScene::Primitive *primitive, const Imath::M44f &matrix, size_t grainSize )
+{
+	const M44f normalMatrix = matrix.inverse().transposed();
+
+	// Several primitive variables may share the same data, and
+	// we must take care to only transform it once.
+	unordered_map<const Data *, DataPtr> transformed;
+	for( auto &primitiveVariable : primitive->variables )
+	{
+		const Data *data = primitiveVariable.second.data.get();
+		auto inserted = transformed.insert( { data, DataPtr() } );
+		if( inserted.second )
+		{
+			if( const V3fVectorData *v3fData = runTimeCast<const V3fVectorData>( data ) )
+			{
+				inserted.first->second = transformVectors( v3fData, matrix, normalMatrix, grainSize );
+			}
+			else if( const V3dVectorData *v3dData = runTimeCast<const V3dVectorData>( data ) )
+			{
+				inserted.first->second = transformVectors( v3dData, matrix, normalMatrix, grainSize );
+			}
+		}
+
+		if( inserted.first->second )
+		{
+			primitiveVariable.second.data = inserted.first->second;
+		}
+	}
+}
@@ -37,6 +37,8 @@
 
 #include "GafferScene/PrimitiveVariableProcessor.h"
 
+#include "GafferScene/PrimitiveVariableAlgo.h"
+
 #include "Gaffer/StringPlug.h"
 
 #include "IECore/StringAlgo.h"
@@ -132,18 +134,35 @@ IECore::ConstObjectPtr PrimitiveVariableProcessor::computeProcessedObject( const
 
 	bool invert = invertNamesPlug()->getValue();
 	IECoreScene::PrimitivePtr result = inputGeometry->copy();
-	IECoreScene::PrimitiveVariableMap::iterator next;
-	for( IECoreScene::PrimitiveVariableMap::iterator it = result->variables.begin(); it != result->variables.end(); it = next )
+
+	std::vector<IECoreScene::PrimitiveVariableMap::iterator> toProcess;
+	for( IECoreScene::PrimitiveVariableMap::iterator it = result->variables.begin(); it != result->variables.end(); ++it )
 	{
-		next = it;
-		next++;
 		if( StringAlgo::matchMultiple( it->first, names ) != invert )
 		{
-			processPrimitiveVariable( path, context, inputGeometry, it->second );
-			if( it->second.interpolation == IECoreScene::PrimitiveVariable::Invalid || !it->second.data )
+			toProcess.push_back( it );
+		}
+	}
+
+	// Each primitive variable is processed independently, so we can
+	// process them in parallel.
+	PrimitiveVariableAlgo::parallelProcessElements(
+		toProcess.size(),
+		[&]( size_t begin, size_t end ) {
+			Context::Scope scope( context );
+			for( size_t i = begin; i < end; ++i )
 			{
-				result->variables.erase( it );
+				processPrimitiveVariable( path, context, inputGeometry, toProcess[i]->second );
 			}
+		},
+		/* grainSize = */ 1
+	);
+
+	for( const auto &it : toProcess )
+	{
+		if( it->second.interpolation == IECoreScene::PrimitiveVariable::Invalid || !it->second.data )
+		{
+			result->variables.erase( it );
 		}
 	}
 
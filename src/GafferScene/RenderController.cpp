@@ -37,6 +37,7 @@
 #include "GafferScene/RenderController.h"
 
 #include "GafferScene/SceneAlgo.h"
+#include "GafferScene/SceneNode.h"
 
 #include "Gaffer/ParallelAlgo.h"
 
@@ -173,6 +174,33 @@ class RenderController::SceneGraph
 			}
 		}
 
+		// As above, but only dirtying the locations matched by `paths`
+		// and their descendants. Ancestors of matching locations have
+		// just their bounds dirtied, since they may contain the changes.
+		void dirty( unsigned components, const IECore::PathMatcher &paths, ScenePlug::ScenePath &path )
+		{
+			const unsigned match = paths.match( path );
+			if( match & ( PathMatcher::ExactMatch | PathMatcher::AncestorMatch ) )
+			{
+				dirty( components );
+				return;
+			}
+			else if( !( match & PathMatcher::DescendantMatch ) )
+			{
+				return;
+			}
+
+			m_dirtyComponents |= components & BoundComponent;
+
+			path.push_back( InternedString() ); // space for the child name
+			for( const auto &c : m_children )
+			{
+				path.back() = c->name();
+				c->dirty( components, paths, path );
+			}
+			path.pop_back();
+		}
+
 		// Called by SceneGraphUpdateTask to update this location. Returns true if
 		// anything changed.
 		bool update( const ScenePlug::ScenePath &path, unsigned changedGlobals, Type type, const RenderController *controller )
@@ -241,7 +269,7 @@ class RenderController::SceneGraph
 
 			// Object
 
-			if( ( m_dirtyComponents & ObjectComponent ) && updateObject( controller->m_scene->objectPlug(), type, controller->m_renderer.get(), controller->m_globals.get(), controller->m_scene.get() ) )
+			if( ( m_dirtyComponents & ObjectComponent ) && updateObject( controller->m_scene->objectPlug(), type, controller->m_renderer.get(), controller->m_globals.get(), controller->m_scene.get(), controller->m_objectCache ) )
 			{
 				m_changedComponents |= ObjectComponent;
 			}
@@ -257,7 +285,7 @@ class RenderController::SceneGraph
 						{
 							// Failed to apply attributes - must replace entire object.
 							m_objectHash = MurmurHash();
-							if( updateObject( controller->m_scene->objectPlug(), type, controller->m_renderer.get(), controller->m_globals.get(), controller->m_scene.get() ) )
+							if( updateObject( controller->m_scene->objectPlug(), type, controller->m_renderer.get(), controller->m_globals.get(), controller->m_scene.get(), controller->m_objectCache ) )
 							{
 								m_changedComponents |= ObjectComponent;
 							}
@@ -473,7 +501,7 @@ class RenderController::SceneGraph
 		}
 
 		// Returns true if the object changed.
-		bool updateObject( const ObjectPlug *objectPlug, Type type, IECoreScenePreview::Renderer *renderer, const IECore::CompoundObject *globals, const ScenePlug *scene )
+		bool updateObject( const ObjectPlug *objectPlug, Type type, IECoreScenePreview::Renderer *renderer, const IECore::CompoundObject *globals, const ScenePlug *scene, RendererAlgo::ObjectCache &objectCache )
 		{
 			const bool hadObjectInterface = static_cast<bool>( m_objectInterface );
 			if( type == NoType )
@@ -488,7 +516,9 @@ class RenderController::SceneGraph
 				return false;
 			}
 
-			IECore::ConstObjectPtr object = objectPlug->getValue( &objectHash );
+			// Sharing identical objects between locations avoids recomputing
+			// them, and allows the renderer to instance them.
+			IECore::ConstObjectPtr object = objectCache.object( scene, objectHash );
 			m_objectHash = objectHash;
 
 			const IECore::NullObject *nullObject = runTimeCast<const IECore::NullObject>( object.get() );
@@ -838,6 +868,9 @@ RenderController::RenderController( const ConstScenePlugPtr &scene, const Gaffer
 		m_minimumExpansionDepth( 0 ),
 		m_updateRequired( false ),
 		m_updateRequested( false ),
+		m_sourceNode( nullptr ),
+		m_editedPathsState( NoEditedPaths ),
+		m_allPathsDirty( true ),
 		m_dirtyGlobalComponents( NoGlobalComponent ),
 		m_globals( new CompoundObject )
 {
@@ -893,6 +926,7 @@ void RenderController::setScene( const ConstScenePlugPtr &scene )
 	m_plugDirtiedConnection = const_cast<Node *>( node )->plugDirtiedSignal().connect(
 		boost::bind( &RenderController::plugDirtied, this, ::_1 )
 	);
+	updateSourceNode();
 
 	dirtyGlobals( AllGlobalComponents );
 	dirtySceneGraphs( SceneGraph::AllComponents );
@@ -973,21 +1007,43 @@ bool RenderController::updateRequired() const
 
 void RenderController::plugDirtied( const Gaffer::Plug *plug )
 {
+	if( plug->node() == m_sourceNode )
+	{
+		// `m_scene` is an output of the source node itself.
+		sourcePlugDirtied( plug );
+	}
+
+	unsigned components = SceneGraph::NoComponent;
 	if( plug == m_scene->boundPlug() )
 	{
-		dirtySceneGraphs( SceneGraph::BoundComponent );
+		components = SceneGraph::BoundComponent;
 	}
 	else if( plug == m_scene->transformPlug() )
 	{
-		dirtySceneGraphs( SceneGraph::TransformComponent );
+		components = SceneGraph::TransformComponent;
 	}
 	else if( plug == m_scene->attributesPlug() )
 	{
-		dirtySceneGraphs( SceneGraph::AttributesComponent );
+		components = SceneGraph::AttributesComponent;
 	}
 	else if( plug == m_scene->objectPlug() )
 	{
-		dirtySceneGraphs( SceneGraph::ObjectComponent );
+		components = SceneGraph::ObjectComponent;
+	}
+
+	if( components != SceneGraph::NoComponent )
+	{
+		// Only trust the edited paths if we're still connected to the
+		// node that reported them.
+		const ScenePlug *source = m_scene->source<ScenePlug>();
+		if( m_editedPathsState == SomeEditedPaths && source && source->node() == m_sourceNode )
+		{
+			dirtySceneGraphs( components, m_editedPaths );
+		}
+		else
+		{
+			dirtySceneGraphs( components );
+		}
 	}
 	else if( plug == m_scene->childNamesPlug() )
 	{
@@ -1003,10 +1059,73 @@ void RenderController::plugDirtied( const Gaffer::Plug *plug )
 	}
 	else if( plug == m_scene )
 	{
+		// All dirtiness for this edit has now reached us,
+		// so we can discard the edited paths.
+		m_editedPathsState = NoEditedPaths;
+		m_editedPaths.clear();
+		updateSourceNode();
 		requestUpdate();
 	}
 }
 
+void RenderController::sourcePlugDirtied( const Gaffer::Plug *plug )
+{
+	if(
+		m_editedPathsState == AllEditedPaths ||
+		plug->children().size() ||
+		m_sourceNode->outPlug()->isAncestorOf( plug )
+	)
+	{
+		// Parent plugs are dirtied after their children, possibly after
+		// `m_scene` itself, so we rely on their children instead.
+		return;
+	}
+
+	IECore::PathMatcher paths;
+	if( m_sourceNode->affectedPaths( plug, paths ) )
+	{
+		m_editedPaths.addPaths( paths );
+		m_editedPathsState = SomeEditedPaths;
+	}
+	else
+	{
+		m_editedPaths.clear();
+		m_editedPathsState = AllEditedPaths;
+	}
+}
+
+void RenderController::updateSourceNode()
+{
+	const ScenePlug *source = m_scene->source<ScenePlug>();
+	const SceneNode *sourceNode = source ? runTimeCast<const SceneNode>( source->node() ) : nullptr;
+	if( sourceNode && source != sourceNode->outPlug() )
+	{
+		sourceNode = nullptr;
+	}
+
+	if( sourceNode == m_sourceNode )
+	{
+		return;
+	}
+
+	m_sourceNode = sourceNode;
+	m_editedPathsState = NoEditedPaths;
+	m_editedPaths.clear();
+
+	if( m_sourceNode && m_sourceNode != m_scene->node() )
+	{
+		m_sourcePlugDirtiedConnection = const_cast<SceneNode *>( m_sourceNode )->plugDirtiedSignal().connect(
+			boost::bind( &RenderController::sourcePlugDirtied, this, ::_1 )
+		);
+	}
+	else
+	{
+		// Either there is no source node, or it is the node
+		// we're already connected to in `setScene()`.
+		m_sourcePlugDirtiedConnection.disconnect();
+	}
+}
+
 void RenderController::contextChanged( const IECore::InternedString &name )
 {
 	if( boost::starts_with( name.string(), "ui:" ) )
@@ -1042,6 +1161,21 @@ void RenderController::dirtySceneGraphs( unsigned components )
 	{
 		sg->dirty( components );
 	}
+	m_allPathsDirty = true;
+	m_dirtyPaths.clear();
+}
+
+void RenderController::dirtySceneGraphs( unsigned components, const IECore::PathMatcher &paths )
+{
+	ScenePlug::ScenePath path;
+	for( auto &sg : m_sceneGraphs )
+	{
+		sg->dirty( components, paths, path );
+	}
+	if( !m_allPathsDirty )
+	{
+		m_dirtyPaths.addPaths( paths );
+	}
 }
 
 void RenderController::update( const ProgressCallback &callback )
@@ -1128,7 +1262,15 @@ void RenderController::updateInternal( const ProgressCallback &callback, const I
 
 		m_dirtyGlobalComponents = NoGlobalComponent;
 
-		// Update scene graphs
+		// Update scene graphs. If only some locations have been
+		// dirtied since the last full update, and nothing global has
+		// changed, then we only need to visit those locations.
+
+		const PathMatcher *pathsToVisit = pathsToUpdate;
+		if( !pathsToUpdate && !m_allPathsDirty && m_changedGlobalComponents == NoGlobalComponent )
+		{
+			pathsToVisit = &m_dirtyPaths;
+		}
 
 		for( int i = SceneGraph::FirstType; i <= SceneGraph::LastType; ++i )
 		{
@@ -1143,11 +1285,15 @@ void RenderController::updateInternal( const ProgressCallback &callback, const I
 
 			tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
 			SceneGraphUpdateTask *task = new( tbb::task::allocate_root( taskGroupContext ) ) SceneGraphUpdateTask(
-				this, sceneGraph, (SceneGraph::Type)i, m_changedGlobalComponents, Context::current(), ScenePlug::ScenePath(), callback, pathsToUpdate
+				this, sceneGraph, (SceneGraph::Type)i, m_changedGlobalComponents, Context::current(), ScenePlug::ScenePath(), callback, pathsToVisit
 			);
 			tbb::task::spawn_root_and_wait( *task );
 		}
 
+		// Objects only need to be shared within a single update, and
+		// we don't want to keep them alive once they've been output.
+		m_objectCache.clear();
+
 		if( m_changedGlobalComponents & CameraOptionsGlobalComponent )
 		{
 			updateDefaultCamera();
@@ -1158,6 +1304,8 @@ void RenderController::updateInternal( const ProgressCallback &callback, const I
 			// Only clear `m_changedGlobalComponents` when we
 			// know our entire scene has been updated successfully.
 			m_changedGlobalComponents = NoGlobalComponent;
+			m_allPathsDirty = false;
+			m_dirtyPaths.clear();
 			m_updateRequired = false;
 		}
 
@@ -1168,6 +1316,7 @@ void RenderController::updateInternal( const ProgressCallback &callback, const I
 	}
 	catch( const IECore::Cancelled &e )
 	{
+		m_objectCache.clear();
 		if( callback )
 		{
 			callback( BackgroundTask::Cancelled );
@@ -1178,6 +1327,7 @@ void RenderController::updateInternal( const ProgressCallback &callback, const I
 	{
 		// No point updating again, since it'll just repeat
 		// the same error.
+		m_objectCache.clear();
 		m_updateRequired = false;
 		if( callback )
 		{
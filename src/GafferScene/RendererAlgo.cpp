@@ -60,9 +60,14 @@
 #include "boost/filesystem.hpp"
 
 #include "tbb/blocked_range.h"
+#include "tbb/concurrent_hash_map.h"
+#include "tbb/parallel_for.h"
 #include "tbb/parallel_reduce.h"
 #include "tbb/task.h"
 
+#include <algorithm>
+#include <atomic>
+
 using namespace std;
 using namespace Imath;
 using namespace IECore;
@@ -85,6 +90,71 @@ void motionTimes( size_t segments, const V2f &shutter, std::set<float> &times )
 	}
 }
 
+// Hashes `plug` at each of `times`. Hashes are much cheaper to compute
+// than values, so we use them to avoid computing identical samples more
+// than once.
+template<typename PlugType>
+void sampleHashes( const PlugType *plug, const std::vector<float> &times, std::vector<MurmurHash> &hashes )
+{
+	hashes.reserve( times.size() );
+	Context::EditableScope timeContext( Context::current() );
+	for( auto t : times )
+	{
+		timeContext.setFrame( t );
+		hashes.push_back( plug->hash() );
+	}
+}
+
+// Computes the value of `plug` at each of `times`, given the hashes from
+// `sampleHashes()`. Samples are computed concurrently, each in its own
+// context, and samples with identical hashes are computed only once. The
+// first `numComputed` values are assumed to have been computed already.
+template<typename PlugType, typename ValueType>
+void sampleValues( const PlugType *plug, const std::vector<float> &times, const std::vector<MurmurHash> &hashes, std::vector<ValueType> &values, size_t numComputed = 0 )
+{
+	values.resize( times.size() );
+
+	vector<size_t> sources( times.size() );
+	vector<size_t> toCompute;
+	for( size_t i = 0; i < times.size(); ++i )
+	{
+		size_t j = 0;
+		while( hashes[j] != hashes[i] )
+		{
+			++j;
+		}
+		sources[i] = j;
+		if( j == i && i >= numComputed )
+		{
+			toCompute.push_back( i );
+		}
+	}
+
+	const Context *context = Context::current();
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, toCompute.size() ),
+		[&]( const tbb::blocked_range<size_t> &r ) {
+			Context::EditableScope timeContext( context );
+			for( size_t i = r.begin(); i != r.end(); ++i )
+			{
+				const size_t sample = toCompute[i];
+				timeContext.setFrame( times[sample] );
+				values[sample] = plug->getValue( &hashes[sample] );
+			}
+		},
+		taskGroupContext
+	);
+
+	for( size_t i = 0; i < times.size(); ++i )
+	{
+		if( sources[i] != i )
+		{
+			values[i] = values[sources[i]];
+		}
+	}
+}
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////
@@ -127,23 +197,26 @@ void transformSamples( const ScenePlug *scene, size_t segments, const Imath::V2f
 	// Motion case
 
 	motionTimes( segments, shutter, sampleTimes );
+	const vector<float> times( sampleTimes.begin(), sampleTimes.end() );
 
-	Context::EditableScope timeContext( Context::current() );
-
-	bool moving = false;
-	samples.reserve( sampleTimes.size() );
-	for( std::set<float>::const_iterator it = sampleTimes.begin(), eIt = sampleTimes.end(); it != eIt; ++it )
+	vector<MurmurHash> hashes;
+	sampleHashes( scene->transformPlug(), times, hashes );
+	if( std::count( hashes.begin(), hashes.end(), hashes.front() ) == (ptrdiff_t)hashes.size() )
 	{
-		timeContext.setFrame( *it );
-		const M44f m = scene->transformPlug()->getValue();
-		if( !moving && !samples.empty() && m != samples.front() )
-		{
-			moving = true;
-		}
-		samples.push_back( m );
+		// All samples are identical, so there's no need
+		// to compute more than one.
+		Context::EditableScope timeContext( Context::current() );
+		timeContext.setFrame( times.front() );
+		samples.push_back( scene->transformPlug()->getValue( &hashes.front() ) );
+		sampleTimes.clear();
+		return;
 	}
 
-	if( !moving )
+	sampleValues( scene->transformPlug(), times, hashes, samples );
+
+	// Different hashes don't guarantee different values,
+	// so check to see if we actually have something moving.
+	if( std::count( samples.begin(), samples.end(), samples.front() ) == (ptrdiff_t)samples.size() )
 	{
 		samples.resize( 1 );
 		sampleTimes.clear();
@@ -168,50 +241,217 @@ void objectSamples( const ScenePlug *scene, size_t segments, const Imath::V2f &s
 	// Motion case
 
 	motionTimes( segments, shutter, sampleTimes );
+	const vector<float> times( sampleTimes.begin(), sampleTimes.end() );
 
-	Context::EditableScope timeContext( Context::current() );
+	vector<MurmurHash> hashes;
+	sampleHashes( scene->objectPlug(), times, hashes );
+
+	// Compute the first sample on its own, so that we don't compute
+	// further samples for objects which we can't motion blur anyway.
 
-	bool moving = false;
-	MurmurHash lastHash;
-	samples.reserve( sampleTimes.size() );
-	for( std::set<float>::const_iterator it = sampleTimes.begin(), eIt = sampleTimes.end(); it != eIt; ++it )
+	vector<ConstObjectPtr> objects( 1 );
 	{
-		timeContext.setFrame( *it );
+		Context::EditableScope timeContext( Context::current() );
+		timeContext.setFrame( times.front() );
+		objects.front() = scene->objectPlug()->getValue( &hashes.front() );
+	}
+
+	const VisibleRenderable *renderable = runTimeCast<const VisibleRenderable>( objects.front().get() );
+	if( !renderable )
+	{
+		// We don't even know what these chappies are, so
+		// don't take any samples at all.
+		sampleTimes.clear();
+		return;
+	}
+
+	if(
+		!runTimeCast<const Primitive>( renderable ) ||
+		std::count( hashes.begin(), hashes.end(), hashes.front() ) == (ptrdiff_t)hashes.size()
+	)
+	{
+		// Either we can't motion blur these chappies, or
+		// nothing is moving. Either way, we just take the
+		// one sample.
+		samples.push_back( renderable );
+		sampleTimes.clear();
+		return;
+	}
 
-		const MurmurHash objectHash = scene->objectPlug()->hash();
-		ConstObjectPtr object = scene->objectPlug()->getValue( &objectHash );
+	// We can support multiple samples, and have something moving.
+	// Compute the remaining samples in parallel.
 
+	sampleValues( scene->objectPlug(), times, hashes, objects, /* numComputed = */ 1 );
+
+	samples.reserve( objects.size() );
+	for( const auto &object : objects )
+	{
 		if( const Primitive *primitive = runTimeCast<const Primitive>( object.get() ) )
 		{
-			// We can support multiple samples for these, so check to see
-			// if we actually have something moving.
-			if( !moving && !samples.empty() && objectHash != lastHash )
+			samples.push_back( primitive );
+		}
+		else
+		{
+			// The object has changed type during the shutter,
+			// so we can't interpolate between the samples.
+			samples.resize( 1 );
+			sampleTimes.clear();
+			return;
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+// ObjectCache
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+typedef std::vector<IECoreScene::ConstVisibleRenderablePtr> SampleVector;
+
+struct Samples
+{
+	SampleVector samples;
+	std::set<float> sampleTimes;
+};
+
+typedef std::shared_ptr<const Samples> ConstSamplesPtr;
+
+} // namespace
+
+struct ObjectCache::Entries
+{
+
+	Entries( size_t memoryLimit )
+		:	memoryLimit( memoryLimit ), objectsMemoryUsage( 0 ), samplesMemoryUsage( 0 )
+	{
+	}
+
+	typedef tbb::concurrent_hash_map<IECore::MurmurHash, ConstObjectPtr> Objects;
+	typedef tbb::concurrent_hash_map<IECore::MurmurHash, ConstSamplesPtr> SamplesMap;
+
+	// Returns the value already stored for `hash`, or null if there is none.
+	template<typename Map>
+	static typename Map::mapped_type find( const Map &map, const IECore::MurmurHash &hash )
+	{
+		typename Map::const_accessor a;
+		if( map.find( a, hash ) )
+		{
+			return a->second;
+		}
+		return typename Map::mapped_type();
+	}
+
+	// Stores `value` for `hash` unless another thread has already stored
+	// a value, returning the value which is stored. The insertion is atomic,
+	// so concurrent callers which each computed a value still all return the
+	// same one. Once `memoryUsage` reaches the memory limit, new values are
+	// returned without being stored, and are not shared.
+	template<typename Map>
+	typename Map::mapped_type insert( Map &map, std::atomic<size_t> &memoryUsage, const IECore::MurmurHash &hash, const typename Map::mapped_type &value, size_t cost )
+	{
+		if( memoryUsage + cost > memoryLimit )
+		{
+			if( auto stored = find( map, hash ) )
 			{
-				moving = true;
+				return stored;
 			}
-			samples.push_back( primitive );
-			lastHash = objectHash;
+			return value;
 		}
-		else if( const VisibleRenderable *renderable = runTimeCast< const VisibleRenderable >( object.get() ) )
+
+		typename Map::accessor a;
+		if( map.insert( a, hash ) )
 		{
-			// We can't motion blur these chappies, so just take the one
-			// sample.
-			samples.push_back( renderable );
-			break;
+			a->second = value;
+			memoryUsage += cost;
 		}
-		else
+		return a->second;
+	}
+
+	const size_t memoryLimit;
+
+	Objects objects;
+	std::atomic<size_t> objectsMemoryUsage;
+
+	SamplesMap samples;
+	std::atomic<size_t> samplesMemoryUsage;
+
+};
+
+ObjectCache::ObjectCache( size_t memoryLimit )
+	:	m_entries( new Entries( memoryLimit ) )
+{
+}
+
+ObjectCache::~ObjectCache()
+{
+}
+
+IECore::ConstObjectPtr ObjectCache::object( const ScenePlug *scene, const IECore::MurmurHash &hash )
+{
+	if( ConstObjectPtr stored = Entries::find( m_entries->objects, hash ) )
+	{
+		return stored;
+	}
+
+	// We compute outside of any lock, because the computation
+	// may be arbitrarily expensive, and may use TBB tasks which
+	// could otherwise deadlock with other users of the cache.
+	// Another thread may compute the same object concurrently,
+	// but `insert()` ensures that we all return the same one.
+	ConstObjectPtr object = scene->objectPlug()->getValue( &hash );
+	return m_entries->insert( m_entries->objects, m_entries->objectsMemoryUsage, hash, object, object->memoryUsage() );
+}
+
+void ObjectCache::objectSamples( const ScenePlug *scene, size_t segments, const Imath::V2f &shutter, std::vector<IECoreScene::ConstVisibleRenderablePtr> &samples, std::set<float> &sampleTimes )
+{
+	// Hashes are much cheaper than the objects themselves, so we
+	// hash all the samples to look them up before computing anything.
+
+	MurmurHash key;
+	if( !segments )
+	{
+		key = scene->objectPlug()->hash();
+	}
+	else
+	{
+		std::set<float> times;
+		motionTimes( segments, shutter, times );
+		Context::EditableScope timeContext( Context::current() );
+		for( auto t : times )
 		{
-			// We don't even know what these chappies are, so
-			// don't take any samples at all.
-			break;
+			timeContext.setFrame( t );
+			key.append( t );
+			key.append( scene->objectPlug()->hash() );
 		}
 	}
 
-	if( !moving )
+	ConstSamplesPtr stored = Entries::find( m_entries->samples, key );
+	if( !stored )
 	{
-		samples.resize( std::min<size_t>( samples.size(), 1 ) );
-		sampleTimes.clear();
+		// As for `object()`, we compute outside of any lock.
+		std::shared_ptr<Samples> computed( new Samples );
+		RendererAlgo::objectSamples( scene, segments, shutter, computed->samples, computed->sampleTimes );
+
+		size_t cost = sizeof( Samples );
+		for( const auto &s : computed->samples )
+		{
+			cost += s->memoryUsage();
+		}
+		stored = m_entries->insert( m_entries->samples, m_entries->samplesMemoryUsage, key, computed, cost );
 	}
+
+	samples = stored->samples;
+	sampleTimes = stored->sampleTimes;
+}
+
+void ObjectCache::clear()
+{
+	m_entries->objects.clear();
+	m_entries->objectsMemoryUsage = 0;
+	m_entries->samples.clear();
+	m_entries->samplesMemoryUsage = 0;
 }
 
 } // namespace RendererAlgo
@@ -274,7 +514,6 @@ SceneProcessorPtr createAdaptors()
 
 } // namespace GafferScene
 
-
 //////////////////////////////////////////////////////////////////////////
 // RenderSets class
 //////////////////////////////////////////////////////////////////////////
@@ -810,8 +1049,8 @@ struct LightOutput : public LocationOutput
 struct ObjectOutput : public LocationOutput
 {
 
-	ObjectOutput( IECoreScenePreview::Renderer *renderer, const IECore::CompoundObject *globals, const GafferScene::RendererAlgo::RenderSets &renderSets, const ScenePlug::ScenePath &root, const ScenePlug *scene )
-		:	LocationOutput( renderer, globals, renderSets, root, scene ), m_cameraSet( renderSets.camerasSet() ), m_lightSet( renderSets.lightsSet() )
+	ObjectOutput( IECoreScenePreview::Renderer *renderer, const IECore::CompoundObject *globals, const GafferScene::RendererAlgo::RenderSets &renderSets, const ScenePlug::ScenePath &root, const ScenePlug *scene, GafferScene::RendererAlgo::ObjectCache &objectCache )
+		:	LocationOutput( renderer, globals, renderSets, root, scene ), m_cameraSet( renderSets.camerasSet() ), m_lightSet( renderSets.lightsSet() ), m_objectCache( &objectCache )
 	{
 	}
 
@@ -828,7 +1067,7 @@ struct ObjectOutput : public LocationOutput
 		}
 
 		vector<ConstVisibleRenderablePtr> samples; set<float> sampleTimes;
-		RendererAlgo::objectSamples( scene, deformationSegments(), shutter(), samples, sampleTimes );
+		m_objectCache->objectSamples( scene, deformationSegments(), shutter(), samples, sampleTimes );
 		if( !samples.size() )
 		{
 			return true;
@@ -859,6 +1098,9 @@ struct ObjectOutput : public LocationOutput
 
 	const PathMatcher &m_cameraSet;
 	const PathMatcher &m_lightSet;
+	// Pointer rather than reference, because
+	// the functor is copied during traversal.
+	GafferScene::RendererAlgo::ObjectCache *m_objectCache;
 
 };
 
@@ -1040,7 +1282,8 @@ void outputLights( const ScenePlug *scene, const IECore::CompoundObject *globals
 
 void outputObjects( const ScenePlug *scene, const IECore::CompoundObject *globals, const RenderSets &renderSets, IECoreScenePreview::Renderer *renderer, const ScenePlug::ScenePath &root )
 {
-	ObjectOutput output( renderer, globals, renderSets, root, scene );
+	ObjectCache objectCache;
+	ObjectOutput output( renderer, globals, renderSets, root, scene, objectCache );
 	SceneAlgo::parallelProcessLocations( scene, output, root );
 }
 
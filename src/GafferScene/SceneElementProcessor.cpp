@@ -98,6 +98,22 @@ void SceneElementProcessor::affects( const Plug *input, AffectedPlugsContainer &
 	}
 }
 
+bool SceneElementProcessor::affectedPaths( const Gaffer::Plug *input, IECore::PathMatcher &paths ) const
+{
+	if( input == inPlug() || inPlug()->isAncestorOf( input ) || input == filterPlug() )
+	{
+		// Edits to the input scene may affect any location, and
+		// edits to the filter affect both the old and new matches.
+		return false;
+	}
+
+	// Our hierarchy is passed through unchanged, and we only process
+	// the locations matched by the filter, so the matches bound the
+	// effect of any edit to our own plugs.
+	const Filter *filter = runTimeCast<const Filter>( filterPlug()->source()->node() );
+	return filter && filter->knownMatches( paths );
+}
+
 void SceneElementProcessor::hashBound( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
 {
 	switch( boundMethod( context ) )
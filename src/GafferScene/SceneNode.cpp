@@ -101,6 +101,11 @@ void SceneNode::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outp
 	}
 }
 
+bool SceneNode::affectedPaths( const Gaffer::Plug *input, IECore::PathMatcher &paths ) const
+{
+	return false;
+}
+
 void SceneNode::hash( const ValuePlug *output, const Context *context, IECore::MurmurHash &h ) const
 {
 	const ScenePlug *scenePlug = output->parent<ScenePlug>();
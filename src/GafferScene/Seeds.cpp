@@ -37,9 +37,14 @@
 
 #include "GafferScene/Seeds.h"
 
+#include "GafferScene/PrimitiveVariableAlgo.h"
+
 #include "Gaffer/StringPlug.h"
 
-#include "IECoreScene/MeshAlgo.h"
+#include "IECoreScene/MeshPrimitive.h"
+#include "IECoreScene/PointsPrimitive.h"
+
+#include "IECore/PointDistribution.h"
 
 using namespace std;
 using namespace Imath;
@@ -48,6 +53,310 @@ using namespace IECoreScene;
 using namespace Gaffer;
 using namespace GafferScene;
 
+//////////////////////////////////////////////////////////////////////////
+// Internal utilities
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Faces are distributed in fixed size batches, so that the
+// partitioning doesn't depend on the number of threads.
+const size_t g_facesPerBatch = 1000;
+
+size_t dataIndex( PrimitiveVariable::Interpolation interpolation, size_t face, size_t faceVertex, int vertex )
+{
+	switch( interpolation )
+	{
+		case PrimitiveVariable::Uniform :
+			return face;
+		case PrimitiveVariable::Vertex :
+		case PrimitiveVariable::Varying :
+			return vertex;
+		case PrimitiveVariable::FaceVarying :
+			return faceVertex;
+		default :
+			return 0;
+	}
+}
+
+float cross( const V2f &a, const V2f &b )
+{
+	return a.x * b.y - a.y * b.x;
+}
+
+// Distributes points over the triangles of each face using the
+// PointDistribution, which positions points according to their
+// UV coordinates. Each face may therefore be processed independently,
+// and the points generated for it are the same regardless of the order
+// in which faces are processed.
+class PointDistributor
+{
+
+	public :
+
+		PointDistributor( const MeshPrimitive *mesh, const std::string &densityPrimitiveVariable )
+			:	m_verticesPerFace( mesh->verticesPerFace()->readable() ),
+				m_vertexIds( mesh->vertexIds()->readable() ),
+				m_uvInterpolation( PrimitiveVariable::Invalid ),
+				m_densityInterpolation( PrimitiveVariable::Invalid ),
+				m_constantDensity( 1.0f )
+		{
+			m_faceOffsets.reserve( m_verticesPerFace.size() );
+			size_t offset = 0;
+			for( int n : m_verticesPerFace )
+			{
+				m_faceOffsets.push_back( offset );
+				offset += n;
+			}
+
+			auto pIt = mesh->variables.find( "P" );
+			const V3fVectorData *p = pIt != mesh->variables.end() ? runTimeCast<const V3fVectorData>( pIt->second.data.get() ) : nullptr;
+			if( !p || pIt->second.interpolation != PrimitiveVariable::Vertex )
+			{
+				throw IECore::Exception( "Seeds : MeshPrimitive has no Vertex \"P\" primitive variable of type V3fVectorData" );
+			}
+			m_p = PrimitiveVariable::IndexedView<V3f>( pIt->second );
+
+			auto uvIt = mesh->variables.find( "uv" );
+			if(
+				uvIt == mesh->variables.end() ||
+				!runTimeCast<const V2fVectorData>( uvIt->second.data.get() ) ||
+				( uvIt->second.interpolation != PrimitiveVariable::FaceVarying && uvIt->second.interpolation != PrimitiveVariable::Vertex && uvIt->second.interpolation != PrimitiveVariable::Varying )
+			)
+			{
+				throw IECore::Exception( "Seeds : MeshPrimitive has no FaceVarying or Vertex \"uv\" primitive variable of type V2fVectorData" );
+			}
+			m_uv = PrimitiveVariable::IndexedView<V2f>( uvIt->second );
+			m_uvInterpolation = uvIt->second.interpolation;
+
+			auto densityIt = mesh->variables.find( densityPrimitiveVariable );
+			if( densityIt != mesh->variables.end() )
+			{
+				if( const FloatData *d = runTimeCast<const FloatData>( densityIt->second.data.get() ) )
+				{
+					m_constantDensity = d->readable();
+				}
+				else if( runTimeCast<const FloatVectorData>( densityIt->second.data.get() ) )
+				{
+					m_density = PrimitiveVariable::IndexedView<float>( densityIt->second );
+					m_densityInterpolation = densityIt->second.interpolation;
+				}
+			}
+		}
+
+		size_t numFaces() const
+		{
+			return m_verticesPerFace.size();
+		}
+
+		// Returns the area of the face, weighted by the density
+		// primitive variable. Used to estimate the number of points
+		// which will be generated.
+		float weightedArea( size_t face ) const
+		{
+			float result = 0;
+			const size_t offset = m_faceOffsets[face];
+			for( int t = 1; t < m_verticesPerFace[face] - 1; ++t )
+			{
+				const size_t fv[3] = { offset, offset + t, offset + t + 1 };
+				const V3f &a = m_p[m_vertexIds[fv[0]]];
+				const V3f &b = m_p[m_vertexIds[fv[1]]];
+				const V3f &c = m_p[m_vertexIds[fv[2]]];
+				const float d = ( density( face, fv[0] ) + density( face, fv[1] ) + density( face, fv[2] ) ) / 3.0f;
+				result += 0.5f * ( ( b - a ) % ( c - a ) ).length() * max( d, 0.0f );
+			}
+			return result;
+		}
+
+		// Appends the points for the face to `points`.
+		void distribute( size_t face, float density, vector<V3f> &points ) const
+		{
+			const size_t offset = m_faceOffsets[face];
+			for( int t = 1; t < m_verticesPerFace[face] - 1; ++t )
+			{
+				const size_t fv[3] = { offset, offset + t, offset + t + 1 };
+
+				const V3f &a = m_p[m_vertexIds[fv[0]]];
+				const V3f &b = m_p[m_vertexIds[fv[1]]];
+				const V3f &c = m_p[m_vertexIds[fv[2]]];
+
+				const V2f &uvA = uv( fv[0] );
+				const V2f &uvB = uv( fv[1] );
+				const V2f &uvC = uv( fv[2] );
+
+				const float uvArea2 = cross( uvB - uvA, uvC - uvA );
+				if( fabs( uvArea2 ) < 1e-12f )
+				{
+					// Degenerate in UV space, so we have no way
+					// of placing points.
+					continue;
+				}
+
+				const float area = 0.5f * ( ( b - a ) % ( c - a ) ).length();
+				const float densityA = this->density( face, fv[0] );
+				const float densityB = this->density( face, fv[1] );
+				const float densityC = this->density( face, fv[2] );
+
+				// Barycentric coordinates of a position in UV space.
+				auto barycentric = [&]( const V2f &pos ) {
+					const V2f d = pos - uvA;
+					const float w1 = cross( d, uvC - uvA ) / uvArea2;
+					const float w2 = cross( uvB - uvA, d ) / uvArea2;
+					return V3f( 1.0f - w1 - w2, w1, w2 );
+				};
+
+				auto densitySampler = [&]( const V2f &pos ) {
+					const V3f w = barycentric( pos );
+					return w[0] * densityA + w[1] * densityB + w[2] * densityC;
+				};
+
+				auto pointEmitter = [&]( const V2f &pos ) {
+					const V3f w = barycentric( pos );
+					if( w[0] >= 0.0f && w[1] >= 0.0f && w[2] >= 0.0f )
+					{
+						points.push_back( a * w[0] + b * w[1] + c * w[2] );
+					}
+				};
+
+				Box2f uvBound( uvA );
+				uvBound.extendBy( uvB );
+				uvBound.extendBy( uvC );
+
+				// The PointDistribution density is specified in UV space,
+				// so we scale to account for the area of the face in UV space.
+				PointDistribution::defaultInstance()( uvBound, density * area / ( 0.5f * fabs( uvArea2 ) ), densitySampler, pointEmitter );
+			}
+		}
+
+	private :
+
+		const V2f &uv( size_t faceVertex ) const
+		{
+			return m_uv[dataIndex( m_uvInterpolation, 0, faceVertex, m_vertexIds[faceVertex] )];
+		}
+
+		float density( size_t face, size_t faceVertex ) const
+		{
+			if( m_densityInterpolation == PrimitiveVariable::Invalid )
+			{
+				return m_constantDensity;
+			}
+			return m_density[dataIndex( m_densityInterpolation, face, faceVertex, m_vertexIds[faceVertex] )];
+		}
+
+		const vector<int> &m_verticesPerFace;
+		const vector<int> &m_vertexIds;
+		vector<size_t> m_faceOffsets;
+
+		PrimitiveVariable::IndexedView<V3f> m_p;
+		PrimitiveVariable::IndexedView<V2f> m_uv;
+		PrimitiveVariable::Interpolation m_uvInterpolation;
+		PrimitiveVariable::IndexedView<float> m_density;
+		PrimitiveVariable::Interpolation m_densityInterpolation;
+		float m_constantDensity;
+
+};
+
+PointsPrimitivePtr distributePoints( const MeshPrimitive *mesh, float density, const std::string &densityPrimitiveVariable, int maxPoints )
+{
+	const PointDistributor distributor( mesh, densityPrimitiveVariable );
+	const size_t numBatches = ( distributor.numFaces() + g_facesPerBatch - 1 ) / g_facesPerBatch;
+
+	if( maxPoints > 0 )
+	{
+		// Reduce the density if necessary to meet the budget. We sum the
+		// areas of each batch serially, so that rounding errors do not
+		// depend on the number of threads.
+		vector<double> batchAreas( numBatches, 0.0 );
+		PrimitiveVariableAlgo::parallelProcessElements(
+			numBatches,
+			[&]( size_t begin, size_t end ) {
+				for( size_t batch = begin; batch < end; ++batch )
+				{
+					const size_t endFace = min( ( batch + 1 ) * g_facesPerBatch, distributor.numFaces() );
+					for( size_t face = batch * g_facesPerBatch; face < endFace; ++face )
+					{
+						batchAreas[batch] += distributor.weightedArea( face );
+					}
+				}
+			},
+			/* grainSize = */ 1
+		);
+
+		double area = 0.0;
+		for( double a : batchAreas )
+		{
+			area += a;
+		}
+
+		const double expectedPoints = area * density;
+		if( expectedPoints > maxPoints )
+		{
+			density *= maxPoints / expectedPoints;
+		}
+	}
+
+	vector<vector<V3f>> batchPoints( numBatches );
+	PrimitiveVariableAlgo::parallelProcessElements(
+		numBatches,
+		[&]( size_t begin, size_t end ) {
+			for( size_t batch = begin; batch < end; ++batch )
+			{
+				const size_t endFace = min( ( batch + 1 ) * g_facesPerBatch, distributor.numFaces() );
+				for( size_t face = batch * g_facesPerBatch; face < endFace; ++face )
+				{
+					distributor.distribute( face, density, batchPoints[batch] );
+				}
+			}
+		},
+		/* grainSize = */ 1
+	);
+
+	size_t numPoints = 0;
+	for( const auto &b : batchPoints )
+	{
+		numPoints += b.size();
+	}
+
+	// Reducing the density only meets the budget approximately, since
+	// the number of points generated for each face isn't known in advance.
+	// If we're still over budget, we discard points at evenly spaced
+	// indices, so that the remaining points are still spread over the
+	// whole mesh and the result doesn't depend on the number of threads.
+	const size_t numKept = maxPoints > 0 ? min( numPoints, (size_t)maxPoints ) : numPoints;
+
+	V3fVectorDataPtr pointsData = new V3fVectorData;
+	pointsData->setInterpretation( GeometricData::Point );
+	vector<V3f> &points = pointsData->writable();
+	points.reserve( numKept );
+	size_t index = 0;
+	for( auto &b : batchPoints )
+	{
+		if( numKept == numPoints )
+		{
+			points.insert( points.end(), b.begin(), b.end() );
+		}
+		else
+		{
+			for( const auto &point : b )
+			{
+				// Keeps exactly `numKept` of the `numPoints` points.
+				if( ( index + 1 ) * numKept / numPoints > index * numKept / numPoints )
+				{
+					points.push_back( point );
+				}
+				index++;
+			}
+		}
+		vector<V3f>().swap( b );
+	}
+
+	return new PointsPrimitive( pointsData );
+}
+
+} // namespace
+
 IE_CORE_DEFINERUNTIMETYPED( Seeds );
 
 size_t Seeds::g_firstPlugIndex = 0;
@@ -60,6 +369,7 @@ Seeds::Seeds( const std::string &name )
 	addChild( new FloatPlug( "density", Plug::In, 1.0f, 0.0f ) );
 	addChild( new StringPlug( "densityPrimitiveVariable" ) );
 	addChild( new StringPlug( "pointType", Plug::In, "gl:point" ) );
+	addChild( new IntPlug( "maxPoints", Plug::In, 0, 0 ) );
 }
 
 Seeds::~Seeds()
@@ -106,11 +416,21 @@ const Gaffer::StringPlug *Seeds::pointTypePlug() const
 	return getChild<StringPlug>( g_firstPlugIndex + 3 );
 }
 
+Gaffer::IntPlug *Seeds::maxPointsPlug()
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 4 );
+}
+
+const Gaffer::IntPlug *Seeds::maxPointsPlug() const
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 4 );
+}
+
 void Seeds::affects( const Plug *input, AffectedPlugsContainer &outputs ) const
 {
 	BranchCreator::affects( input, outputs );
 
-	if( input == densityPlug() || input == densityPrimitiveVariablePlug() || input == pointTypePlug() )
+	if( input == densityPlug() || input == densityPrimitiveVariablePlug() || input == pointTypePlug() || input == maxPointsPlug() )
 	{
 		outputs.push_back( outPlug()->objectPlug() );
 	}
@@ -168,6 +488,7 @@ void Seeds::hashBranchObject( const ScenePath &parentPath, const ScenePath &bran
 		densityPlug()->hash( h );
 		densityPrimitiveVariablePlug()->hash( h );
 		pointTypePlug()->hash( h );
+		maxPointsPlug()->hash( h );
 		return;
 	}
 
@@ -185,11 +506,11 @@ IECore::ConstObjectPtr Seeds::computeBranchObject( const ScenePath &parentPath,
 			return outPlug()->objectPlug()->defaultValue();
 		}
 
-		PointsPrimitivePtr result = MeshAlgo::distributePoints(
+		PointsPrimitivePtr result = distributePoints(
 			mesh.get(),
 			densityPlug()->getValue(),
-			V2f( 0 ),
-			densityPrimitiveVariablePlug()->getValue()
+			densityPrimitiveVariablePlug()->getValue(),
+			maxPointsPlug()->getValue()
 		);
 		result->variables["type"] = PrimitiveVariable( PrimitiveVariable::Constant, new StringData( pointTypePlug()->getValue() ) );
 
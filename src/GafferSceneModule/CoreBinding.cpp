@@ -269,6 +269,16 @@ std::string pathToStringWrapper( const ScenePlug::ScenePath &scenePath )
 	return result;
 }
 
+object affectedPathsWrapper( const SceneNode &node, const Gaffer::Plug *input )
+{
+	IECore::PathMatcher paths;
+	if( node.affectedPaths( input, paths ) )
+	{
+		return object( paths );
+	}
+	return object();
+}
+
 } // namespace
 
 void GafferSceneModule::bindCore()
@@ -316,7 +326,9 @@ void GafferSceneModule::bindCore()
 	ScenePathFromString();
 
 	typedef ComputeNodeWrapper<SceneNode> SceneNodeWrapper;
-	GafferBindings::DependencyNodeClass<SceneNode, SceneNodeWrapper>();
+	GafferBindings::DependencyNodeClass<SceneNode, SceneNodeWrapper>()
+		.def( "affectedPaths", &affectedPathsWrapper )
+	;
 
 	typedef ComputeNodeWrapper<SceneProcessor> SceneProcessorWrapper;
 	GafferBindings::DependencyNodeClass<SceneProcessor, SceneProcessorWrapper>()
@@ -63,6 +63,16 @@ ScenePlugPtr getInputScene( const Gaffer::Context *context )
 	return const_cast<ScenePlug *>( Filter::getInputScene( context ) );
 }
 
+object knownMatches( const Filter &filter )
+{
+	IECore::PathMatcher paths;
+	if( filter.knownMatches( paths ) )
+	{
+		return object( paths );
+	}
+	return object();
+}
+
 } // namespace
 
 void GafferSceneModule::bindFilter()
@@ -73,6 +83,7 @@ void GafferSceneModule::bindFilter()
 		.staticmethod( "setInputScene" )
 		.def( "getInputScene", &getInputScene )
 		.staticmethod( "getInputScene" )
+		.def( "knownMatches", &knownMatches )
 	;
 
 	PlugClass<FilterPlug>()
@@ -38,13 +38,16 @@
 
 #include "HierarchyBinding.h"
 
+#include "GafferScene/CameraVisibilityProcessor.h"
 #include "GafferScene/Capsule.h"
 #include "GafferScene/CollectScenes.h"
 #include "GafferScene/Duplicate.h"
 #include "GafferScene/Encapsulate.h"
+#include "GafferScene/FrustumCull.h"
 #include "GafferScene/Group.h"
 #include "GafferScene/Instancer.h"
 #include "GafferScene/Isolate.h"
+#include "GafferScene/LevelOfDetail.h"
 #include "GafferScene/Parent.h"
 #include "GafferScene/Prune.h"
 #include "GafferScene/Seeds.h"
@@ -78,6 +81,18 @@ ContextPtr context( const Capsule &c )
 	return const_cast<Context *>( c.context() );
 }
 
+size_t representation( const LevelOfDetail &l, const ScenePlug::ScenePath &path )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return l.representation( path );
+}
+
+bool culled( const FrustumCull &f, const ScenePlug::ScenePath &path )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return f.culled( path );
+}
+
 } // namespace
 
 void GafferSceneModule::bindHierarchy()
@@ -113,4 +128,14 @@ void GafferSceneModule::bindHierarchy()
 	GafferBindings::DependencyNodeClass<Instancer>();
 	GafferBindings::DependencyNodeClass<Encapsulate>();
 
+	GafferBindings::DependencyNodeClass<CameraVisibilityProcessor>();
+
+	GafferBindings::DependencyNodeClass<LevelOfDetail>()
+		.def( "representation", &representation )
+	;
+
+	GafferBindings::DependencyNodeClass<FrustumCull>()
+		.def( "culled", &culled )
+	;
+
 }